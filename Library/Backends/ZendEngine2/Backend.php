@@ -497,6 +497,35 @@ class Backend extends BaseBackend
         $context->codePrinter->output($this->getVariableCode($variable) . ' = ' . $code . ';');
     }
 
+    /**
+     * Returns the kernel function appending to a string
+     */
+    public function getConcatSelfFunction($suffix, CompilationContext $context, Variable $variable = null)
+    {
+        return 'zephir_concat_self' . $suffix;
+    }
+
+    /**
+     * Gives back the spare capacity of a string appended to inside a loop
+     */
+    public function trimGrownString(Variable $variable, CompilationContext $context)
+    {
+    }
+
+    /**
+     * Called before a loop is compiled
+     */
+    public function onLoopEnter(array $statement, CompilationContext $context)
+    {
+    }
+
+    /**
+     * Called once a loop has been compiled
+     */
+    public function onLoopExit(CompilationContext $context)
+    {
+    }
+
     public function concatSelf(Variable $variable, Variable $itemVariable, CompilationContext $context)
     {
         $variable = $this->getVariableCodePointer($variable);
@@ -779,7 +808,15 @@ class Backend extends BaseBackend
         }
     }
 
-    private function resolveOffsetExprs($offsetExprs, $compilationContext)
+    /**
+     * Resolves the offsets of a multi-dimensional array update into a key signature
+     * ('a' append, 'l' long, 's' string, 'z' zval) and the C code of every offset
+     *
+     * @param array $offsetExprs
+     * @param CompilationContext $compilationContext
+     * @return array
+     */
+    protected function resolveOffsetExprs($offsetExprs, $compilationContext)
     {
         $keys = '';
         $offsetItems = array();
@@ -825,12 +862,12 @@ class Backend extends BaseBackend
                             $numberParams++;
                             break;
                         default:
-                            throw new CompilerException("Variable: " . $variableIndex->getType() . " cannot be used as array index", $statement);
+                            throw new CompilerException("Variable: " . $variableIndex->getType() . " cannot be used as array index", $offsetExpr->getOriginal());
                     }
                     break;
 
                 default:
-                    throw new CompilerException("Value: " . $offsetExpr->getType() . " cannot be used as array index", $statement);
+                    throw new CompilerException("Value: " . $offsetExpr->getType() . " cannot be used as array index", $offsetExpr->getOriginal());
             }
         }
         return array($keys, $offsetItems, $numberParams);
@@ -953,7 +990,7 @@ class Backend extends BaseBackend
         }
     }
 
-    public function updateStaticProperty($classEntry, $property, $value, CompilationContext $context)
+    public function updateStaticProperty($classEntry, $property, $value, CompilationContext $context, $classDefinition = null)
     {
         $value = $this->resolveValue($value, $context);
         $context->codePrinter->output('zephir_update_static_property_ce(' . $classEntry .', SL("' . $property . '"), &' . $value . ' TSRMLS_CC);');
@@ -39,8 +39,9 @@ class FcallManager
     /**
      * Resolve internal fcall attributes to a suitable macro and ensure that it's generated during compilation
      * @param doReturn tri-state: 0 -> no return value, 1 -> do return, 2 -> do return to given variable
+     * @param typedParams positions of the parameters passed as they are (native C values or NULL) instead of zvals
      */
-    public function getMacro($static, $doReturn, $paramCount)
+    public function getMacro($static, $doReturn, $paramCount, array $typedParams = array())
     {
         /*
         $scopes = array('', 'STATIC');
@@ -55,8 +56,15 @@ class FcallManager
             }
         }
         $macroName = 'ZEPHIR_' . ($scope ? $scope . '_' : '') . $mode . $paramCount;
+        if (count($typedParams)) {
+            $signature = '';
+            for ($i = 0; $i < $paramCount; ++$i) {
+                $signature .= isset($typedParams[$i]) ? 'T' : 'Z';
+            }
+            $macroName .= '_' . $signature;
+        }
         if (!$this->macroIsRequired($macroName)) {
-            $this->requiredMacros[$macroName] = array($scope, $mode, $paramCount);
+            $this->requiredMacros[$macroName] = array($scope, $mode, $paramCount, $typedParams);
         }
         return $macroName;
     }
@@ -70,7 +78,7 @@ class FcallManager
 
         ksort($this->requiredMacros);
         foreach ($this->requiredMacros as $name => $info) {
-            list($scope, $mode, $paramCount) = $info;
+            list($scope, $mode, $paramCount, $typedParams) = $info;
             $paramsStr = '';
             $retParam = '';
             $retValueUsed = '0';
@@ -118,8 +126,13 @@ class FcallManager
                 $codePrinter->output('ZEPHIR_SET_SCOPE(scope_ce, scope_ce); \\');
             }
 
-            /* Create new zval's for parameters */
+            /* Create new zval's for parameters, omitted parameters are passed as NULL */
+            $args = array();
             for ($i = 0; $i < $paramCount; ++$i) {
+                $args[] = $params[$i];
+                if (isset($typedParams[$i])) {
+                    continue;
+                }
                 //$zv = '_' . $params[$i];
                 //$zvals[] = $zv;
                 //$initStatements[] = 'ALLOC_ZVAL(' . $zv . '); \\';
@@ -136,7 +149,7 @@ class FcallManager
             foreach ($initStatements as $statement) {
                 $codePrinter->output($statement);
             }
-            $zvalStr = $i ? ', ' . implode(', ', $zvals) : '';
+            $zvalStr = count($args) ? ', ' . implode(', ', $args) : '';
             $retExpr = '';
             if ($retParam) {
                 if ($retParam == 'return_value') {
@@ -7,11 +7,14 @@ use Zephir\Compiler;
 use Zephir\CompilerException;
 use Zephir\CompilationContext;
 use Zephir\ClassMethod;
+use Zephir\ClassDefinition;
+use Zephir\ClassProperty;
 use Zephir\FunctionDefinition;
 use Zephir\Backends\ZendEngine2\Backend as BackendZendEngine2;
 use Zephir\BaseBackend;
 use Zephir\GlobalConstant;
 use Zephir\Utils;
+use Zephir\Cache\SlotsCache;
 
 class Backend extends BackendZendEngine2
 {
@@ -47,6 +50,91 @@ class Backend extends BackendZendEngine2
         return $code;
     }
 
+    /**
+     * Returns the kernel function appending to a string, appends to the strings a loop doesn't otherwise
+     * use keep spare capacity and the variable is remembered to be trimmed once the outermost loop is left
+     */
+    public function getConcatSelfFunction($suffix, CompilationContext $context, Variable $variable = null)
+    {
+        if ($context->insideCycle && $variable && isset($context->growableStrings[$variable->getName()])) {
+            $context->grownStrings[$variable->getName()] = $variable;
+            return 'zephir_concat_self_grow' . $suffix;
+        }
+        return 'zephir_concat_self' . $suffix;
+    }
+
+    /**
+     * Gives back the spare capacity of a string appended to inside a loop
+     */
+    public function trimGrownString(Variable $variable, CompilationContext $context)
+    {
+        if (isset($context->grownStrings[$variable->getName()])) {
+            $context->codePrinter->output('zephir_concat_self_trim(' . $this->getVariableCode($variable) . ');');
+        }
+    }
+
+    /**
+     * Looks for the strings that can keep spare capacity while the outermost loop is compiled,
+     * those are the variables only ever appended to or assigned inside it. A string that is read,
+     * stored or passed anywhere in the loop would carry the spare capacity with it
+     */
+    public function onLoopEnter(array $statement, CompilationContext $context)
+    {
+        if ($context->insideCycle) {
+            return;
+        }
+        $appended = array();
+        $used = array();
+        $this->collectStringUses($statement, $appended, $used);
+        $context->growableStrings = array_diff_key($appended, $used);
+    }
+
+    /**
+     * Walks a statement tree recording the variables appended to with .= and any other use of a variable
+     */
+    protected function collectStringUses(array $node, array &$appended, array &$used)
+    {
+        if (isset($node['type'], $node['value']) && $node['type'] == 'variable' && is_string($node['value'])) {
+            $used[$node['value']] = true;
+        }
+
+        if (isset($node['assign-type'], $node['variable']) && is_string($node['variable'])) {
+            $operator = isset($node['operator']) ? $node['operator'] : null;
+            if ($node['assign-type'] == 'variable' && $operator == 'concat-assign') {
+                $appended[$node['variable']] = true;
+            } elseif ($node['assign-type'] != 'variable' || $operator != 'assign') {
+                $used[$node['variable']] = true;
+            }
+        }
+
+        foreach ($node as $child) {
+            if (is_array($child)) {
+                $this->collectStringUses($child, $appended, $used);
+            }
+        }
+    }
+
+    /**
+     * Trims the strings grown inside a loop once the outermost loop is left, inner loops
+     * keep the spare capacity for the appends still made by the enclosing ones
+     */
+    public function onLoopExit(CompilationContext $context)
+    {
+        if ($context->insideCycle) {
+            return;
+        }
+        foreach ($context->grownStrings as $variable) {
+            $this->trimGrownString($variable, $context);
+        }
+        $context->grownStrings = array();
+        $context->growableStrings = array();
+    }
+
+    public function concatSelf(Variable $variable, Variable $itemVariable, CompilationContext $context)
+    {
+        $context->codePrinter->output($this->getConcatSelfFunction('', $context, $variable) . '(' . $this->getVariableCode($variable) . ', ' . $this->getVariableCode($itemVariable) . ');');
+    }
+
     public function getStringsManager()
     {
         return new StringsManager();
@@ -67,6 +155,10 @@ class Backend extends BackendZendEngine2
                 return array('', 'zend_ulong');
             case 'zend_string':
                 return array('*', 'zend_string');
+            case 'int[]':
+            case 'double[]':
+            case 'bool[]':
+                return array('*', 'zval');
         }
         list ($pointer, $code) = parent::getTypeDefinition($type);
         return array($pointer, $code);
@@ -118,7 +210,7 @@ class Backend extends BackendZendEngine2
     public function generateInitCode(&$groupVariables, $type, $pointer, Variable $variable)
     {
 
-        $isComplex = ($type == 'variable' || $type == 'string' || $type == 'array' || $type == 'resource' || $type == 'callable' || $type == 'object');
+        $isComplex = ($type == 'variable' || $type == 'string' || $type == 'array' || $type == 'resource' || $type == 'callable' || $type == 'object' || $variable->isNativeArray());
 
         if ($isComplex && !$variable->isDoublePointer()) { /* && $variable->mustInitNull() */
             $groupVariables[] = $variable->getName();
@@ -236,6 +328,13 @@ class Backend extends BackendZendEngine2
         $parameters = $method->getParameters();
         if (is_object($parameters)) {
             foreach ($parameters->getParameters() as $parameter) {
+                /* Scalars are passed by value in direct calls */
+                if ($method->isTypedInternalParameter($parameter, $context)) {
+                    list (, $type) = $this->getTypeDefinition($parameter['data-type']);
+                    $signatureParameters[] = $type . ' ' . $parameter['name'] . '_param_ext';
+                    continue;
+                }
+
                 switch ($parameter['data-type']) {
                     case 'int':
                     case 'uint':
@@ -266,6 +365,17 @@ class Backend extends BackendZendEngine2
     /* Assign value to variable */
     public function assignString(Variable $variable, $value, CompilationContext $context, $useCodePrinter = true, $doCopy = null)
     {
+        if (!($value instanceof Variable)) {
+            if ($value === null || $value === '') {
+                $output = 'ZVAL_EMPTY_STRING(' . $this->getVariableCode($variable) . ');';
+            } else {
+                $output = 'ZVAL_INTERNED_STR(' . $this->getVariableCode($variable) . ', ' . $context->stringsManager->addLiteralString($value) . ');';
+            }
+            if ($useCodePrinter) {
+                $context->codePrinter->output($output);
+            }
+            return $output;
+        }
         return $this->assignHelper('ZVAL_STRING', $this->getVariableCode($variable), $value, $context, $useCodePrinter, null);
     }
 
@@ -281,6 +391,17 @@ class Backend extends BackendZendEngine2
 
     public function returnString($value, CompilationContext $context, $useCodePrinter = true)
     {
+        if (!($value instanceof Variable)) {
+            if ($value === null || $value === '') {
+                $output = 'RETURN_MM_EMPTY_STRING();';
+            } else {
+                $output = 'RETURN_MM_INTERNED_STR(' . $context->stringsManager->addLiteralString($value) . ');';
+            }
+            if ($useCodePrinter) {
+                $context->codePrinter->output($output);
+            }
+            return $output;
+        }
         return $this->returnHelper('RETURN_MM_STRING', $value, $context, $useCodePrinter, null);
     }
 
@@ -349,7 +470,8 @@ class Backend extends BackendZendEngine2
             if ($value instanceof Variable) {
                 $valueStr = 'Z_STRVAL_P(' . $this->getVariableCode($value) . '), Z_STRLEN_P(' . $this->getVariableCode($value) . ')';
             } else {
-                $valueStr = 'SL("' . $value->getCode()  . '")';
+                $type = 'str';
+                $valueStr = $context->stringsManager->addLiteralString($value->getCode());
             }
         } else if ($type == 'zval') {
             $valueStr = $this->getVariableCode($value);
@@ -371,10 +493,30 @@ class Backend extends BackendZendEngine2
         return $output;
     }
 
+    public function arrayFetch(Variable $var, Variable $src, $index, $flags, $arrayAccess, CompilationContext $context, $useCodePrinter = true)
+    {
+        if (!($index instanceof Variable) && $index->getType() == 'string') {
+            $interned = $this->getInternedString($index->getCode(), $context);
+            if ($interned) {
+                $context->headersManager->add('kernel/array');
+                $output = 'zephir_array_fetch_str(' . $this->getVariableCodePointer($var) . ', ' . $this->getVariableCode($src) . ', ' . $interned . ', ' . $flags . ', "' . Compiler::getShortUserPath($arrayAccess['file']) . '", ' . $arrayAccess['line'] . ');';
+                if ($useCodePrinter) {
+                    $context->codePrinter->output($output);
+                }
+                return $output;
+            }
+        }
+        return parent::arrayFetch($var, $src, $index, $flags, $arrayAccess, $context, $useCodePrinter);
+    }
+
     public function arrayIsset(Variable $var, $resolvedExpr, $expression, CompilationContext $context)
     {
         if (!($resolvedExpr instanceof Variable)) {
             if ($resolvedExpr->getType() == 'string') {
+                $interned = $this->getInternedString($resolvedExpr->getCode(), $context);
+                if ($interned) {
+                    return new CompiledExpression('bool', 'zephir_array_isset_str(' . $this->getVariableCode($var) . ', ' . $interned . ')', $expression);
+                }
                 return new CompiledExpression('bool', 'zephir_array_isset_string(' . $this->getVariableCode($var) . ', SL("' . $resolvedExpr->getCode() . '"))', $expression);
             }
         }
@@ -386,6 +528,10 @@ class Backend extends BackendZendEngine2
         if (!($resolvedExpr instanceof Variable)) {
             $code = $this->getVariableCode($target) . ', ' . $this->getVariableCode($var);
             if ($resolvedExpr->getType() == 'string') {
+                $interned = $this->getInternedString($resolvedExpr->getCode(), $context);
+                if ($interned) {
+                    return new CompiledExpression('bool', 'zephir_array_isset_str_fetch(' . $code . ', ' . $interned . ', ' . $flags . ')', $expression);
+                }
                 return new CompiledExpression('bool', 'zephir_array_isset_string_fetch(' . $code . ', SL("' . $resolvedExpr->getCode() . '"), ' . $flags . ')', $expression);
             }
         }
@@ -394,6 +540,10 @@ class Backend extends BackendZendEngine2
 
     public function propertyIsset(Variable $var, $key, CompilationContext $context)
     {
+        $interned = $this->getInternedString($key, $context);
+        if ($interned) {
+            return new CompiledExpression('bool', 'zephir_isset_property_str(' . $this->getVariableCode($var) . ', ' . $interned . ')', null);
+        }
         return new CompiledExpression('bool', 'zephir_isset_property(' . $this->getVariableCode($var) . ', SL("' . $key . '"))', null);
     }
 
@@ -408,6 +558,107 @@ class Backend extends BackendZendEngine2
         return parent::arrayUnset($variable, $exprIndex, $flags, $context);
     }
 
+    public function assignArrayMulti(Variable $variable, $symbolVariable, $offsetExprs, CompilationContext $compilationContext)
+    {
+        $compilationContext->headersManager->add('kernel/array');
+        $value = $this->resolveValue($symbolVariable, $compilationContext, true);
+        $pointer = $this->getNestedArrayPointer($compilationContext);
+
+        $compilationContext->codePrinter->output($pointer . ' = zephir_array_nested_root(' . $this->getVariableCode($variable) . ');');
+        $this->assignArrayNested($pointer, $value, $offsetExprs, $compilationContext);
+    }
+
+    public function assignPropertyArrayMulti(Variable $variable, $valueVariable, $propertyName, $offsetExprs, CompilationContext $compilationContext)
+    {
+        $compilationContext->headersManager->add('kernel/array');
+        $value = $this->resolveValue($valueVariable, $compilationContext, true);
+        $pointer = $this->getNestedArrayPointer($compilationContext);
+
+        $codePrinter = $compilationContext->codePrinter;
+        $codePrinter->output($pointer . ' = zephir_fetch_property_nested(' . $this->getVariableCode($variable) . ', SL("' . $propertyName . '"));');
+        $codePrinter->output('if (' . $pointer . ') {');
+        $codePrinter->increaseLevel();
+        $this->assignArrayNested($pointer, $value, $offsetExprs, $compilationContext);
+        $codePrinter->decreaseLevel();
+        $codePrinter->output('} else {');
+        $codePrinter->increaseLevel();
+        parent::assignPropertyArrayMulti($variable, $valueVariable, $propertyName, $offsetExprs, $compilationContext);
+        $codePrinter->decreaseLevel();
+        $codePrinter->output('}');
+    }
+
+    public function assignStaticPropertyArrayMulti($classEntry, $valueVariable, $propertyName, $offsetExprs, CompilationContext $compilationContext)
+    {
+        $compilationContext->headersManager->add('kernel/array');
+        $value = $this->resolveValue($valueVariable, $compilationContext, true);
+        $pointer = $this->getNestedArrayPointer($compilationContext);
+
+        $codePrinter = $compilationContext->codePrinter;
+        $codePrinter->output($pointer . ' = zephir_fetch_static_property_nested(' . $classEntry . ', SL("' . $propertyName . '"));');
+        $codePrinter->output('if (' . $pointer . ') {');
+        $codePrinter->increaseLevel();
+        $this->assignArrayNested($pointer, $value, $offsetExprs, $compilationContext);
+        $codePrinter->decreaseLevel();
+        $codePrinter->output('} else {');
+        $codePrinter->increaseLevel();
+        parent::assignStaticPropertyArrayMulti($classEntry, $valueVariable, $propertyName, $offsetExprs, $compilationContext);
+        $codePrinter->decreaseLevel();
+        $codePrinter->output('}');
+    }
+
+    /**
+     * Creates the zval pointer used to walk the levels of a nested array update
+     *
+     * @param CompilationContext $context
+     * @return string
+     */
+    protected function getNestedArrayPointer(CompilationContext $context)
+    {
+        $pointer = $context->symbolTable->addTemp('variable', $context);
+        $pointer->setIsDoublePointer(true);
+        return $pointer->getName();
+    }
+
+    /**
+     * Emits a nested array update specialized for its offsets: every intermediate level is
+     * fetched for write and separated in place, the value is stored in the innermost one
+     *
+     * @param string $pointer
+     * @param string $value
+     * @param array $offsetExprs
+     * @param CompilationContext $context
+     */
+    protected function assignArrayNested($pointer, $value, $offsetExprs, CompilationContext $context)
+    {
+        list($keys, $offsetItems) = $this->resolveOffsetExprs($offsetExprs, $context);
+
+        $types = array('a' => 'a', 'l' => 'long', 's' => 'string', 'z' => 'zval');
+        $offsets = array();
+        foreach (str_split($keys) as $key) {
+            $offsets[] = array($types[$key], $key == 'a' ? null : array_shift($offsetItems));
+        }
+
+        $codePrinter = $context->codePrinter;
+        list($type, $key) = array_pop($offsets);
+        foreach ($offsets as $offset) {
+            $codePrinter->output($pointer . ' = zephir_array_nested_' . $offset[0] . '(' . $pointer . ', ' . $offset[1] . ');');
+        }
+
+        $codePrinter->output('if (' . $pointer . ') {');
+        switch ($type) {
+            case 'a':
+                $codePrinter->output("\t" . 'zephir_array_append(' . $pointer . ', ' . $value . ', 0 ZEPHIR_DEBUG_PARAMS_DUMMY);');
+                break;
+            case 'long':
+                $codePrinter->output("\t" . 'zephir_array_update_long(' . $pointer . ', ' . $key . ', ' . $value . ', PH_COPY ZEPHIR_DEBUG_PARAMS_DUMMY);');
+                break;
+            default:
+                $codePrinter->output("\t" . 'zephir_array_update_' . $type . '(' . $pointer . ', ' . $key . ', ' . $value . ', PH_COPY);');
+                break;
+        }
+        $codePrinter->output('}');
+    }
+
     public function fetchGlobal(Variable $globalVar, CompilationContext $compilationContext, $useCodePrinter = true)
     {
         $name = $globalVar->getName();
@@ -424,7 +675,7 @@ class Backend extends BackendZendEngine2
         if ($guarded) {
             $context->codePrinter->output('if (!' . $zendClassEntry->getName() . ') {');
         }
-        $context->codePrinter->output($zendClassEntry->getName() . ' = zephir_fetch_class_str_ex(' . $className . ', ZEND_FETCH_CLASS_AUTO);');
+        $context->codePrinter->output($zendClassEntry->getName() . ' = zephir_fetch_class_str_cached(' . $className . ', ZEND_FETCH_CLASS_AUTO, ' . SlotsCache::getClassEntrySlot() . ');');
         if ($guarded) {
             $context->codePrinter->output('}');
         }
@@ -438,11 +689,17 @@ class Backend extends BackendZendEngine2
         }
         $variableCode = $this->getVariableCode($variableVariable);
         $symbol = $this->getVariableCode($symbolVariable);
-        //TODO: maybe optimizations (read_nproperty/quick) for thisScope access in NG (as in ZE2 - if necessary)
         if ($property instanceof Variable) {
             $context->codePrinter->output('zephir_read_property_zval(' . $symbol . ', ' . $variableCode . ', ' . $this->getVariableCode($property) . ', ' . $flags . ');');
         } else {
-            $context->codePrinter->output('zephir_read_property(' . $symbol . ', ' . $variableCode . ', SL("' . $property . '"), ' . $flags . ');');
+            $offset = $this->getPropertyOffset($variableVariable, $property, $context);
+            if ($offset) {
+                $context->codePrinter->output('zephir_read_property_offset(' . $symbol . ', ' . $variableCode . ', ' . $offset . ', SL("' . $property . '"), ' . $flags . ');');
+            } else if ($interned = $this->getInternedString($property, $context)) {
+                $context->codePrinter->output('zephir_read_property_str(' . $symbol . ', ' . $variableCode . ', ' . $interned . ', ' . $flags . ');');
+            } else {
+                $context->codePrinter->output('zephir_read_property(' . $symbol . ', ' . $variableCode . ', SL("' . $property . '"), ' . $flags . ');');
+            }
         }
     }
 
@@ -452,8 +709,12 @@ class Backend extends BackendZendEngine2
         if ($readOnly) {
             $flags .= ' | PH_READONLY';
         }
-        //TODO: maybe optimizations aswell as above
-        $context->codePrinter->output('zephir_read_static_property_ce(&' . $symbolVariable->getName() . ', ' . $classDefinition->getClassEntry() . ', SL("' . $property . '"), ' . $flags . ');');
+        $offset = $this->getStaticPropertyOffset($classDefinition, $property, $context);
+        if ($offset) {
+            $context->codePrinter->output('zephir_read_static_property_offset(&' . $symbolVariable->getName() . ', ' . $classDefinition->getClassEntry() . ', ' . $offset . ', SL("' . $property . '"), ' . $flags . ');');
+        } else {
+            $context->codePrinter->output('zephir_read_static_property_ce(&' . $symbolVariable->getName() . ', ' . $classDefinition->getClassEntry() . ', SL("' . $property . '"), ' . $flags . ');');
+        }
     }
 
     public function resolveValue($value, CompilationContext $context, $usePointer = false)
@@ -505,19 +766,110 @@ class Backend extends BackendZendEngine2
 
     public function updateProperty(Variable $symbolVariable, $propertyName, $value, CompilationContext $context)
     {
-        //TODO: maybe optimizations aswell as above
         $value = $this->resolveValue($value, $context);
         if ($propertyName instanceof Variable) {
             $context->codePrinter->output('zephir_update_property_zval_zval(' . $this->getVariableCode($symbolVariable) . ', ' . $this->getVariableCode($propertyName) . ', ' . $value . ' TSRMLS_CC);');
         } else {
-            $context->codePrinter->output('zephir_update_property_zval(' . $this->getVariableCode($symbolVariable) . ', SL("' . $propertyName . '"), ' . $value . ');');
+            $offset = $this->getPropertyOffset($symbolVariable, $propertyName, $context);
+            if ($offset) {
+                $context->codePrinter->output('zephir_update_property_offset(' . $this->getVariableCode($symbolVariable) . ', ' . $offset . ', SL("' . $propertyName . '"), ' . $value . ');');
+            } else if ($interned = $this->getInternedString($propertyName, $context)) {
+                $context->codePrinter->output('zephir_update_property_zval_str(' . $this->getVariableCode($symbolVariable) . ', ' . $interned . ', ' . $value . ');');
+            } else {
+                $context->codePrinter->output('zephir_update_property_zval(' . $this->getVariableCode($symbolVariable) . ', SL("' . $propertyName . '"), ' . $value . ');');
+            }
         }
     }
 
-    public function updateStaticProperty($classEntry, $property, $value, CompilationContext $context)
+    /**
+     * Returns the C symbol of the interned string created at MINIT for a constant name
+     *
+     * @param string $name
+     * @param CompilationContext $context
+     * @return string|false
+     */
+    protected function getInternedString($name, CompilationContext $context)
+    {
+        if (!$context->stringsManager instanceof StringsManager) {
+            return false;
+        }
+
+        return $context->stringsManager->addInternedString($name);
+    }
+
+    /**
+     * Returns the slot offset of a property declared by a Zephir class when it's accessed through 'this'
+     *
+     * @param Variable $variable
+     * @param string $propertyName
+     * @param CompilationContext $context
+     * @return string|false
+     */
+    protected function getPropertyOffset(Variable $variable, $propertyName, CompilationContext $context)
+    {
+        if ($variable->getRealName() != 'this') {
+            return false;
+        }
+
+        $classDefinition = $context->classDefinition;
+        if (!$classDefinition instanceof ClassDefinition || !$classDefinition->hasProperty($propertyName)) {
+            return false;
+        }
+
+        $property = $classDefinition->getProperty($propertyName);
+        if (!$property instanceof ClassProperty || $property->isStatic()) {
+            return false;
+        }
+
+        $declaringDefinition = $property->getClassDefinition();
+        if (!$declaringDefinition instanceof ClassDefinition || $declaringDefinition->isBundled() || $declaringDefinition->isExternal()) {
+            return false;
+        }
+
+        /**
+         * Private properties of a parent class live in a different slot than the one visible from this scope
+         */
+        if ($property->isPrivate() && $declaringDefinition !== $classDefinition) {
+            return false;
+        }
+
+        if (!$declaringDefinition->getPropertyOffsetsCount($context)) {
+            return false;
+        }
+
+        return $declaringDefinition->getPropertyOffset($propertyName);
+    }
+
+    public function updateStaticProperty($classEntry, $property, $value, CompilationContext $context, $classDefinition = null)
     {
         $value = $this->resolveValue($value, $context);
-        $context->codePrinter->output('zephir_update_static_property_ce(' . $classEntry .', SL("' . $property . '"), ' . $value . ');');
+        $offset = $this->getStaticPropertyOffset($classDefinition, $property, $context);
+        if ($offset) {
+            $context->codePrinter->output('zephir_update_static_property_offset(' . $classEntry .', ' . $offset . ', SL("' . $property . '"), ' . $value . ');');
+        } else {
+            $context->codePrinter->output('zephir_update_static_property_ce(' . $classEntry .', SL("' . $property . '"), ' . $value . ');');
+        }
+    }
+
+    /**
+     * Returns the slot offset of a static property declared by the Zephir class it's accessed through
+     *
+     * @param ClassDefinition|null $classDefinition
+     * @param string $propertyName
+     * @param CompilationContext $context
+     * @return string|false
+     */
+    protected function getStaticPropertyOffset($classDefinition, $propertyName, CompilationContext $context)
+    {
+        if (!$classDefinition instanceof ClassDefinition || $classDefinition->isBundled() || $classDefinition->isExternal()) {
+            return false;
+        }
+
+        if (!$classDefinition->getPropertyOffsetsCount($context, true)) {
+            return false;
+        }
+
+        return $classDefinition->getPropertyOffset($propertyName, true);
     }
 
     public function callMethod($symbolVariable, Variable $variable, $methodName, $cachePointer, $params, CompilationContext $context)
@@ -527,6 +879,9 @@ class Backend extends BackendZendEngine2
         if ($methodName instanceof Variable) {
             $macro = 'CALL_METHOD_ZVAL';
             $methodName = $this->getVariableCode($methodName);
+        } else if ($interned = $this->getInternedString($methodName, $context)) {
+            $macro = 'CALL_METHOD_STR';
+            $methodName = $interned;
         } else {
             $methodName = '"' . $methodName . '"';
         }
@@ -682,4 +1037,167 @@ class Backend extends BackendZendEngine2
     {
         return $compilationContext->symbolTable->getTempNonTrackedVariable($type, $compilationContext);
     }
-}
+
+    /**
+     * Returns the C expression of an offset in a native typed array
+     */
+    public function getNativeArrayIndex(CompiledExpression $exprIndex, CompilationContext $context, $statement = null)
+    {
+        switch ($exprIndex->getType()) {
+            case 'int':
+            case 'uint':
+            case 'long':
+            case 'ulong':
+                return $exprIndex->getCode();
+
+            case 'variable':
+                $variableIndex = $context->symbolTable->getVariableForRead($exprIndex->getCode(), $context, $statement);
+                switch ($variableIndex->getType()) {
+                    case 'int':
+                    case 'uint':
+                    case 'long':
+                    case 'ulong':
+                        return $variableIndex->getName();
+
+                    case 'variable':
+                        return 'zval_get_long(' . $this->getVariableCode($variableIndex) . ')';
+                }
+                throw new CompilerException("Variable: " . $variableIndex->getType() . " cannot be used as native array index", $statement);
+        }
+
+        throw new CompilerException("Index: " . $exprIndex->getType() . " cannot be used as native array index", $statement);
+    }
+
+    /**
+     * Returns the C expression of a value converted to the element type of a native typed array
+     */
+    public function getNativeArrayValue(Variable $native, CompiledExpression $resolvedExpr, CompilationContext $context, $statement = null)
+    {
+        $elementType = $native->getNativeArrayElementType();
+
+        switch ($resolvedExpr->getType()) {
+            case 'null':
+                return '0';
+
+            case 'bool':
+                $code = $resolvedExpr->getBooleanCode();
+                break;
+
+            case 'char':
+            case 'uchar':
+                $code = '\'' . $resolvedExpr->getCode() . '\'';
+                break;
+
+            case 'int':
+            case 'uint':
+            case 'long':
+            case 'ulong':
+            case 'double':
+                $code = $resolvedExpr->getCode();
+                break;
+
+            case 'variable':
+                $itemVariable = $context->symbolTable->getVariableForRead($resolvedExpr->getCode(), $context, $statement);
+                switch ($itemVariable->getType()) {
+                    case 'int':
+                    case 'uint':
+                    case 'long':
+                    case 'ulong':
+                    case 'char':
+                    case 'uchar':
+                    case 'double':
+                    case 'bool':
+                        $code = $itemVariable->getName();
+                        break;
+
+                    case 'variable':
+                        $symbol = $this->getVariableCode($itemVariable);
+                        switch ($elementType) {
+                            case 'long':
+                                return 'zval_get_long(' . $symbol . ')';
+                            case 'double':
+                                return 'zval_get_double(' . $symbol . ')';
+                            default:
+                                $context->headersManager->add('kernel/operators');
+                                return 'zephir_is_true(' . $symbol . ')';
+                        }
+
+                    default:
+                        throw new CompilerException("Variable: " . $itemVariable->getType() . " cannot be stored in " . $native->getType(), $statement);
+                }
+                break;
+
+            default:
+                throw new CompilerException("Expression: " . $resolvedExpr->getType() . " cannot be stored in " . $native->getType(), $statement);
+        }
+
+        switch ($elementType) {
+            case 'long':
+                return '(zend_long) (' . $code . ')';
+            case 'double':
+                return '(double) (' . $code . ')';
+            default:
+                return '((' . $code . ') ? 1 : 0)';
+        }
+    }
+
+    /**
+     * Iterates a native typed array with a plain C loop over its buffer
+     */
+    public function forNativeArray(Variable $exprVariable, $keyVariable, $variable, $statement, $statementBlock, CompilationContext $compilationContext)
+    {
+        $codePrinter = $compilationContext->codePrinter;
+        $elementType = $exprVariable->getNativeArrayElementType();
+        $symbol = $this->getVariableCode($exprVariable);
+
+        $countVariable = $compilationContext->symbolTable->addTemp('long', $compilationContext);
+        $indexVariable = $compilationContext->symbolTable->addTemp('long', $compilationContext);
+        $index = $indexVariable->getName();
+
+        $codePrinter->output($countVariable->getName() . ' = zephir_native_' . $elementType . '_count(' . $symbol . ');');
+        if ($statement['reverse']) {
+            $codePrinter->output('for (' . $index . ' = ' . $countVariable->getName() . ' - 1; ' . $index . ' >= 0; ' . $index . '--) {');
+        } else {
+            $codePrinter->output('for (' . $index . ' = 0; ' . $index . ' < ' . $countVariable->getName() . '; ' . $index . '++) {');
+        }
+
+        $codePrinter->increaseLevel();
+
+        if (isset($keyVariable)) {
+            if ($keyVariable->getType() == 'variable') {
+                $compilationContext->symbolTable->mustGrownStack(true);
+                $keyVariable->initVariant($compilationContext);
+                $codePrinter->output('ZVAL_LONG(' . $this->getVariableCode($keyVariable) . ', ' . $index . ');');
+            } else {
+                $codePrinter->output($keyVariable->getName() . ' = ' . $index . ';');
+            }
+        }
+
+        if (isset($variable)) {
+            $value = 'zephir_native_' . $elementType . '_get(' . $symbol . ', ' . $index . ')';
+            if ($variable->getType() == 'variable') {
+                $compilationContext->symbolTable->mustGrownStack(true);
+                $variable->initVariant($compilationContext);
+                $codePrinter->output('ZVAL_' . strtoupper($elementType) . '(' . $this->getVariableCode($variable) . ', ' . $value . ');');
+            } else {
+                $codePrinter->output($variable->getName() . ' = ' . $value . ';');
+            }
+        }
+
+        $codePrinter->decreaseLevel();
+
+        /**
+         * Compile statements in the 'for' block
+         */
+        if (isset($statement['statements'])) {
+            $statementBlock->isLoop(true);
+            if (isset($statement['key'])) {
+                $statementBlock->getMutateGatherer()->increaseMutations($statement['key']);
+            }
+            $statementBlock->getMutateGatherer()->increaseMutations($statement['value']);
+            $statementBlock->compile($compilationContext);
+        }
+
+        $codePrinter->output('}');
+    }
+}
\ No newline at end of file
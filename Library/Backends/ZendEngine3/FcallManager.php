@@ -38,7 +38,7 @@ class FcallManager extends ZE2FcallManager
 
         ksort($this->requiredMacros);
         foreach ($this->requiredMacros as $name => $info) {
-            list($scope, $mode, $paramCount) = $info;
+            list($scope, $mode, $paramCount, $typedParams) = $info;
             $paramsStr = '';
             $retParam = '';
             $retValueUsed = '0';
@@ -86,21 +86,27 @@ class FcallManager extends ZE2FcallManager
                 $codePrinter->output('ZEPHIR_SET_SCOPE(scope_ce, scope_ce); \\');
             }
 
-            /* Create new zval's for parameters */
+            /* Create new zval's for parameters, native values are passed as they are */
+            $args = array();
             for ($i = 0; $i < $paramCount; ++$i) {
+                if (isset($typedParams[$i])) {
+                    $args[] = '(' . $params[$i] . ')';
+                    continue;
+                }
                 $zv = '_' . $params[$i];
                 $zvals[] = $zv;
+                $args[] = '&' . $zv;
                 $initStatements[] = 'ZVAL_COPY(&' . $zv . ', ' . $params[$i] . '); \\';
                 $postStatements[] = 'Z_TRY_DELREF_P(' . $params[$i] . '); \\';
                 //$postStatements[] = 'zval_ptr_dtor(' . $params[$i] . '); \\';
             }
-            if ($i) {
+            if (count($zvals)) {
                 $codePrinter->output('zval ' . implode(', ', $zvals) . '; \\');
             }
             foreach ($initStatements as $statement) {
                 $codePrinter->output($statement);
             }
-            $zvalStr = $i ? ', &' . implode(', &', $zvals) : '';
+            $zvalStr = count($args) ? ', ' . implode(', ', $args) : '';
             $codePrinter->output('method(0, ' . $retParam . ', ' . ($scope ? 'NULL, ' : $objParam) . $retValueUsed . $zvalStr . '); \\');
             if ($mode == 'CALL_INTERNAL_METHOD_NORETURN_P') {
                 $postStatements[] = 'zval_ptr_dtor(rvp); \\';
@@ -49,9 +49,69 @@ class StringsManager extends BaseStringsManager
         $this->concatKeys[$key] = true;
     }
 
+    /**
+     * Registers a constant property/array-key name to be created as an interned string at MINIT
+     * and returns the C symbol holding it, names that aren't plain identifiers are not interned
+     *
+     * @param string $name
+     * @return string|boolean
+     */
+    public function addInternedString($name)
+    {
+        if (!$this->isIdentifier($name)) {
+            return false;
+        }
+
+        $this->internedStrings[$name] = true;
+        return $this->getInternedStringSymbol($name);
+    }
+
+    /**
+     * Registers a string literal (as it's written in the C source) to be created as an interned
+     * string at MINIT and returns the C symbol holding it
+     *
+     * @param string $value
+     * @return string
+     */
+    public function addLiteralString($value)
+    {
+        $this->internedStrings[$value] = true;
+        return $this->getInternedStringSymbol($value);
+    }
+
+    /**
+     * Returns the C symbol holding an interned string, literals that aren't plain identifiers
+     * are named after their hash
+     *
+     * @param string $name
+     * @return string
+     */
+    public function getInternedStringSymbol($name)
+    {
+        if (!$this->isIdentifier($name)) {
+            return $this->symbolPrefix . '_literal_' . substr(sha1($name), 0, 16);
+        }
+
+        return $this->symbolPrefix . '_interned_' . $name;
+    }
+
+    /**
+     * Checks whether a string can be used as part of a C symbol
+     *
+     * @param string $name
+     * @return boolean
+     */
+    protected function isIdentifier($name)
+    {
+        return (bool) preg_match('/^[a-zA-Z_][a-zA-Z0-9_]{0,63}$/', $name);
+    }
+
     /**
      * Generates the concatenation code
      *
+     * Every zephir_concat_<key> function computes the total length first and allocates the result once,
+     * scalar operands are formatted into stack buffers instead of being converted to zvals
+     *
      * @return array
      */
     public function genConcatCode()
@@ -67,6 +127,92 @@ class StringsManager extends BaseStringsManager
 #include "kernel/main.h"
 #include "kernel/memory.h"
 #include "kernel/concat.h"' . PHP_EOL . PHP_EOL;
+
+        $code .= <<<EOF
+/**
+ * An operand resolved to a buffer, strings are used in place and scalars are formatted on the stack
+ */
+typedef struct _zephir_concat_operand {
+	const char *str;
+	size_t len;
+	zend_string *tmp;
+	char buf[64];
+} zephir_concat_operand;
+
+static zend_always_inline void zephir_concat_operand_init(zephir_concat_operand *operand, zval *op)
+{
+	char *end;
+
+	operand->tmp = NULL;
+
+	switch (Z_TYPE_P(op)) {
+		case IS_STRING:
+			operand->str = Z_STRVAL_P(op);
+			operand->len = Z_STRLEN_P(op);
+			return;
+
+		case IS_LONG:
+			end = operand->buf + sizeof(operand->buf) - 1;
+			*end = '\\0';
+			operand->str = zend_print_long_to_buf(end, Z_LVAL_P(op));
+			operand->len = end - operand->str;
+			return;
+
+		case IS_UNDEF:
+		case IS_NULL:
+		case IS_FALSE:
+			operand->str = "";
+			operand->len = 0;
+			return;
+
+		case IS_TRUE:
+			operand->str = "1";
+			operand->len = 1;
+			return;
+
+		case IS_DOUBLE:
+			if (EG(precision) >= 0 && EG(precision) < 40) {
+				operand->len = slprintf(operand->buf, sizeof(operand->buf), "%.*G", (int) EG(precision), Z_DVAL_P(op));
+				operand->str = operand->buf;
+				return;
+			}
+			break;
+	}
+
+	operand->tmp = zval_get_string(op);
+	operand->str = ZSTR_VAL(operand->tmp);
+	operand->len = ZSTR_LEN(operand->tmp);
+}
+
+static zend_always_inline void zephir_concat_operand_release(zephir_concat_operand *operand)
+{
+	if (operand->tmp) {
+		zend_string_release(operand->tmp);
+	}
+}
+
+/**
+ * Returns the string the operands are appended to, the left operand is extended in place when it's
+ * uniquely owned and no operand points into it, otherwise it's copied and returned in previous
+ */
+static zend_always_inline zend_string *zephir_concat_self_target(zval *result, size_t length, int aliased, zend_string **previous)
+{
+	zend_string *str = Z_STR_P(result), *target;
+
+	if (!aliased && !ZSTR_IS_INTERNED(str) && GC_REFCOUNT(str) == 1) {
+		*previous = NULL;
+		return zend_string_extend(str, ZSTR_LEN(str) + length, 0);
+	}
+
+	target = zend_string_alloc(ZSTR_LEN(str) + length, 0);
+	memcpy(ZSTR_VAL(target), ZSTR_VAL(str), ZSTR_LEN(str));
+	*previous = str;
+	return target;
+}
+
+
+EOF;
+
         $pcodeh = '
 #ifndef ZEPHIR_KERNEL_CONCAT_H
 #define ZEPHIR_KERNEL_CONCAT_H
@@ -81,11 +227,10 @@ class StringsManager extends BaseStringsManager
         foreach ($this->concatKeys as $key => $one) {
             $len = strlen($key);
             $params = array();
-            $zvalCopy = array();
-            $useCopy = array();
+            $operands = array();
+            $aliases = array();
             $avars = array();
             $zvars = array();
-            $svars = array();
             $lengths = array();
             $sparams = array();
             $lparams = array();
@@ -97,14 +242,13 @@ class StringsManager extends BaseStringsManager
                     $params[] = 'const char *op' . $n . ', zend_uint op' . $n . '_len';
                     $lparams[] = 'op' . $n . ', sizeof(op' . $n . ')-1';
                     $lengths[] = 'op' . $n . '_len';
-                    $svars[] = $n;
                     $avars[$n] = 's';
                 } else {
                     $params[] = 'zval *op' . $n;
                     $lparams[] = 'op' . $n;
-                    $zvalCopy[] = 'op' . $n . '_copy';
-                    $useCopy[] = 'use_copy' . $n . ' = 0';
-                    $lengths[] = 'Z_STRLEN_P(op' . $n . ')';
+                    $operands[] = 's' . $n;
+                    $aliases[] = '(Z_TYPE_P(op' . $n . ') == IS_STRING && Z_STR_P(op' . $n . ') == Z_STR_P(result))';
+                    $lengths[] = 's' . $n . '.len';
                     $zvars[] = $n;
                     $avars[$n] = 'v';
                 }
@@ -114,71 +258,67 @@ class StringsManager extends BaseStringsManager
             $macros[] = '#define ZEPHIR_SCONCAT_' . strtoupper($key) . '(result, ' . join(', ', $sparams) . ') \\' . PHP_EOL . "\t" . ' zephir_concat_' . $key . '(result, ' . join(', ', $lparams) . ', 1);';
             $macros[] = '';
 
-            $proto = 'void zephir_concat_' . $key . '(zval *result, ' . join(', ', $params) . ', int self_var)';
             $proto = 'void zephir_concat_' . $key . '(zval *result, ' . join(', ', $params) . ', int self_var)';
 
             $codeh .= '' . $proto . ';' . PHP_EOL;
 
             $code .= $proto . '{' . PHP_EOL . PHP_EOL;
 
-            if (count($zvalCopy)) {
-                $code .= "\t" . 'zval result_copy, ' . join(', ', $zvalCopy) . ';' . PHP_EOL;
-                $code .= "\t" . 'int use_copy = 0, ' . join(', ', $useCopy) . ';' . PHP_EOL;
-            } else {
-                $code .= "\t" . 'zval result_copy;' . PHP_EOL;
-                $code .= "\t" . 'int use_copy = 0;' . PHP_EOL;
+            if (count($operands)) {
+                $code .= "\t" . 'zephir_concat_operand ' . join(', ', $operands) . ';' . PHP_EOL;
             }
-            $code .= "\t" . 'uint offset = 0, length;' . PHP_EOL . PHP_EOL;
+            $code .= "\t" . 'zend_string *target, *previous = NULL;' . PHP_EOL;
+            $code .= "\t" . 'size_t offset = 0, length;' . PHP_EOL . PHP_EOL;
+
+            /**
+             * The left operand is made printable before the operands to preserve the evaluation order
+             */
+            $code .= "\t" . 'if (self_var && Z_TYPE_P(result) != IS_STRING) {' . PHP_EOL;
+            $code .= "\t\t" . 'target = zval_get_string(result);' . PHP_EOL;
+            $code .= "\t\t" . 'zval_ptr_dtor(result);' . PHP_EOL;
+            $code .= "\t\t" . 'ZVAL_STR(result, target);' . PHP_EOL;
+            $code .= "\t" . '}' . PHP_EOL . PHP_EOL;
 
             foreach ($zvars as $zvar) {
-                $code .= "\t" . 'if (Z_TYPE_P(op' . $zvar . ') != IS_STRING) {' . PHP_EOL;
-                $code .= "\t" . '   use_copy' . $zvar . ' = zend_make_printable_zval(op' . $zvar . ', &op' . $zvar . '_copy);' . PHP_EOL;
-                $code .= "\t" . '   if (use_copy' . $zvar . ') {' . PHP_EOL;
-                $code .= "\t" . '       op' . $zvar . ' = &op' . $zvar . '_copy;' . PHP_EOL;
-                $code .= "\t" . '   }' . PHP_EOL;
-                $code .= "\t" . '}' . PHP_EOL . PHP_EOL;
+                $code .= "\t" . 'zephir_concat_operand_init(&s' . $zvar . ', op' . $zvar . ');' . PHP_EOL;
+            }
+            if (count($zvars)) {
+                $code .= PHP_EOL;
             }
 
             $code .= "\t" . 'length = ' . join(' + ', $lengths) . ';' . PHP_EOL;
             $code .= "\t" . 'if (self_var) {' . PHP_EOL;
-            $code .= '' .PHP_EOL;
-            $code .= "\t\t" . 'if (Z_TYPE_P(result) != IS_STRING) {' . PHP_EOL;
-            $code .= "\t\t\t" . 'use_copy = zend_make_printable_zval(result, &result_copy);' . PHP_EOL;
-            $code .= "\t\t\t" . 'if (use_copy) {' . PHP_EOL;
-            $code .= "\t\t\t\t" .'ZEPHIR_CPY_WRT_CTOR(result, (&result_copy));' . PHP_EOL;
-            $code .= "\t\t\t" .'}'. PHP_EOL;
-            $code .= "\t\t" . '}'. PHP_EOL . PHP_EOL;
             $code .= "\t\t" . 'offset = Z_STRLEN_P(result);' . PHP_EOL;
-            $code .= "\t\t" . 'length += offset;' . PHP_EOL;
-            $code .= "\t\t" . 'Z_STR_P(result) = zend_string_realloc(Z_STR_P(result), length, 0);' . PHP_EOL;
-            $code .= '' . PHP_EOL;
-            $code .= "\t" .'} else {' . PHP_EOL;
-            $code .= "\t\t" . 'ZVAL_STR(result, zend_string_alloc(length, 0));' . PHP_EOL;
+            if (count($aliases)) {
+                $code .= "\t\t" . 'target = zephir_concat_self_target(result, length, ' . join(' || ', $aliases) . ', &previous);' . PHP_EOL;
+            } else {
+                $code .= "\t\t" . 'target = zephir_concat_self_target(result, length, 0, &previous);' . PHP_EOL;
+            }
+            $code .= "\t" . '} else {' . PHP_EOL;
+            $code .= "\t\t" . 'target = zend_string_alloc(length, 0);' . PHP_EOL;
             $code .= "\t" . '}' . PHP_EOL . PHP_EOL;
 
-            $position = '';
             foreach ($avars as $n => $type) {
                 if ($type == 's') {
-                    $code .= "\t" . 'memcpy(Z_STRVAL_P(result) + offset' . $position . ', op' . $n . ', op' . $n . '_len);' . PHP_EOL;
-                    $position .= ' + op' . $n . '_len';
+                    $code .= "\t" . 'memcpy(ZSTR_VAL(target) + offset, op' . $n . ', op' . $n . '_len);' . PHP_EOL;
+                    $code .= "\t" . 'offset += op' . $n . '_len;' . PHP_EOL;
                 } else {
-                    $code .= "\t" . 'memcpy(Z_STRVAL_P(result) + offset' . $position . ', Z_STRVAL_P(op' . $n . '), Z_STRLEN_P(op' . $n . '));' . PHP_EOL;
-                    $position .= ' + Z_STRLEN_P(op' . $n . ')';
+                    $code .= "\t" . 'memcpy(ZSTR_VAL(target) + offset, s' . $n . '.str, s' . $n . '.len);' . PHP_EOL;
+                    $code .= "\t" . 'offset += s' . $n . '.len;' . PHP_EOL;
                 }
             }
 
-            $code .= "\t" . 'Z_STRVAL_P(result)[length] = 0;' . PHP_EOL;
-            $code .= "\t" . 'zend_string_forget_hash_val(Z_STR_P(result));' . PHP_EOL;
+            $code .= "\t" . 'ZSTR_VAL(target)[offset] = 0;' . PHP_EOL;
+            $code .= "\t" . 'zend_string_forget_hash_val(target);' . PHP_EOL . PHP_EOL;
 
             foreach ($zvars as $zvar) {
-                $code .= "\t" . 'if (use_copy' . $zvar . ') {' . PHP_EOL;
-                $code .= "\t" . '   zval_dtor(op' . $zvar . ');' . PHP_EOL;
-                $code .= "\t" . '}' . PHP_EOL . PHP_EOL;
+                $code .= "\t" . 'zephir_concat_operand_release(&s' . $zvar . ');' . PHP_EOL;
             }
 
-            $code .= "\t" . 'if (use_copy) {' . PHP_EOL;
-            $code .= "\t" . '   zval_dtor(&result_copy);' . PHP_EOL;
+            $code .= "\t" . 'if (previous) {' . PHP_EOL;
+            $code .= "\t\t" . 'zend_string_release(previous);' . PHP_EOL;
             $code .= "\t" . '}' . PHP_EOL . PHP_EOL;
+            $code .= "\t" . 'ZVAL_NEW_STR(result, target);' . PHP_EOL;
 
             $code .= "}" . PHP_EOL . PHP_EOL;
         }
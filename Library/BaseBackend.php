@@ -53,6 +53,10 @@ abstract class BaseBackend
     abstract public function assignNull(Variable $variable, CompilationContext $context, $useCodePrinter = true);
     abstract public function assignZval(Variable $variable, $code, CompilationContext $context);
     abstract public function concatSelf(Variable $variable, Variable $itemVariable, CompilationContext $context);
+    abstract public function getConcatSelfFunction($suffix, CompilationContext $context, Variable $variable = null);
+    abstract public function trimGrownString(Variable $variable, CompilationContext $context);
+    abstract public function onLoopEnter(array $statement, CompilationContext $context);
+    abstract public function onLoopExit(CompilationContext $context);
     abstract public function returnString($value, CompilationContext $context, $useCodePrinter = true);
     abstract public function initArray(Variable $variable, CompilationContext $context, $size = null, $useCodePrinter = true);
     abstract public function createClosure(Variable $variable, $classDefinition, CompilationContext $context);
@@ -68,7 +72,7 @@ abstract class BaseBackend
     abstract public function fetchProperty(Variable $symbolVariable, Variable $variableVariable, $property, $readOnly, CompilationContext $context, $useOptimized = false);
     abstract public function fetchStaticProperty(Variable $symbolVariable, $classDefinition, $property, $readOnly, CompilationContext $context);
     abstract public function updateProperty(Variable $symbolVariable, $propertyName, $value, CompilationContext $compilationContext);
-    abstract public function updateStaticProperty($classEntry, $property, $value, CompilationContext $context);
+    abstract public function updateStaticProperty($classEntry, $property, $value, CompilationContext $context, $classDefinition = null);
     abstract public function assignArrayProperty(Variable $variable, $property, $key, $value, CompilationContext $context);
 
     abstract public function checkConstructor(Variable $var, CompilationContext $context);
@@ -38,8 +38,16 @@ class SlotsCache
 
     private static $cacheFunctionSlots = array();
 
+    private static $callableSlot = 1;
+
+    private static $classEntrySlot = 1;
+
     const MAX_SLOTS_NUMBER = 512;
 
+    const MAX_CALLABLE_SLOTS_NUMBER = 128;
+
+    const MAX_CLASS_ENTRY_SLOTS_NUMBER = 256;
+
     /**
      * Returns or creates a cache slot for a function
      *
@@ -76,6 +84,36 @@ class SlotsCache
         return 0;
     }
 
+    /**
+     * Creates a cache slot for a call site invoking dynamic callables
+     *
+     * @return int
+     */
+    public static function getCallableSlot()
+    {
+        $slot = self::$callableSlot++;
+        if ($slot >= self::MAX_CALLABLE_SLOTS_NUMBER) {
+            return 0;
+        }
+
+        return $slot;
+    }
+
+    /**
+     * Creates a cache slot for a call site looking up a class entry by name
+     *
+     * @return int
+     */
+    public static function getClassEntrySlot()
+    {
+        $slot = self::$classEntrySlot++;
+        if ($slot >= self::MAX_CLASS_ENTRY_SLOTS_NUMBER) {
+            return 0;
+        }
+
+        return $slot;
+    }
+
     /**
      * Returns or creates a cache slot for a method
      *
@@ -52,6 +52,8 @@ class Call
 
     protected $_mustCheckForCopy = array();
 
+    protected $_typedParams = array();
+
     /**
      * Processes the symbol variable that will be used to return
      * the result of the symbol call
@@ -174,6 +176,19 @@ class Call
         return $this->_isExpecting;
     }
 
+    /**
+     * Returns the variable the external expression expects the call to return its value to
+     *
+     * @return Variable|null
+     */
+    public function getExpectingVariable()
+    {
+        if (!$this->_expression->isExpectingReturn()) {
+            return null;
+        }
+        return $this->_expression->getExpectingVariable();
+    }
+
     /**
      * Returns if the symbol to be returned by the call must be initialized
      *
@@ -338,12 +353,38 @@ class Call
             }
         }
 
+        /**
+         * Direct calls to internal methods receive static typed parameters as native values
+         */
+        $typedParams = array();
+        if ($calleeDefinition instanceof ClassMethod && $calleeDefinition->isInternal() && is_object($calleeDefinition->getParameters())) {
+            if (!$this->canCallInternal($calleeDefinition, $exprParams, $compilationContext, $expression)) {
+                throw new CompilerException("Invalid parameters passed to internal method: '" . $calleeDefinition->getName() . "'", $expression);
+            }
+            foreach ($calleeDefinition->getParameters() as $position => $parameter) {
+                if ($calleeDefinition->isTypedInternalParameter($parameter, $compilationContext)) {
+                    $typedParams[$position] = $parameter['data-type'];
+                }
+            }
+        }
+
         $params = array();
         $types = array();
         $dynamicTypes = array();
         $mustCheck = array();
         foreach ($exprParams as $position => $compiledExpression) {
             $expression = $compiledExpression->getOriginal();
+
+            if (isset($typedParams[$position])) {
+                $typedCode = $this->getTypedParameterCode($compiledExpression, $typedParams[$position], $compilationContext);
+                if ($typedCode !== null) {
+                    $params[] = $typedCode;
+                    $types[] = $typedParams[$position];
+                    $dynamicTypes[] = $typedParams[$position];
+                    continue;
+                }
+            }
+
             switch ($compiledExpression->getType()) {
                 case 'null':
                     $parameterVariable = $compilationContext->backend->getScalarTempVariable('variable', $compilationContext);
@@ -399,7 +440,11 @@ class Call
                     if ($compilationContext->backend->getName() == 'ZendEngine2') {
                         $mustCheck[] = $parameterVariable->getName();
                     }
-                    $params[] = $compilationContext->backend->getVariableCode($parameterVariable);
+                    if ($this->isMovableParameter(count($params), $calleeDefinition, $compilationContext)) {
+                        $params[] = 'ZEPHIR_MOVE_PARAM(' . $compilationContext->backend->getVariableCode($parameterVariable) . ', ' . count($params) . ')';
+                    } else {
+                        $params[] = $compilationContext->backend->getVariableCode($parameterVariable);
+                    }
                     $types[] = $compiledExpression->getType();
                     $dynamicTypes[] = $compiledExpression->getType();
                     break;
@@ -473,14 +518,209 @@ class Call
                 default:
                     throw new CompilerException("Cannot use value type: " . $compiledExpression->getType() . " as parameter", $expression);
             }
+
+            /**
+             * Values without a native representation are passed boxed and converted as the callee would do
+             */
+            if (isset($typedParams[$position])) {
+                $params[] = $this->getBoxedTypedParameterCode(array_pop($params), $typedParams[$position], $compilationContext);
+            }
+        }
+
+        /**
+         * Omitted optional parameters are passed as NULL so the callee assigns their default value
+         */
+        if ($calleeDefinition instanceof ClassMethod && $calleeDefinition->isInternal() && is_object($calleeDefinition->getParameters())) {
+            $calleeParameters = $calleeDefinition->getParameters()->getParameters();
+            for ($position = count($params); $position < count($calleeParameters); $position++) {
+                $params[] = 'NULL';
+                $typedParams[$position] = 'null';
+                $types[] = 'null';
+                $dynamicTypes[] = 'null';
+            }
         }
 
         $this->_resolvedTypes = $types;
         $this->_resolvedDynamicTypes = $dynamicTypes;
         $this->_mustCheckForCopy = $mustCheck;
+        $this->_typedParams = $typedParams;
         return $params;
     }
 
+    /**
+     * Checks if a temporary parameter can be handed over to the callee frame instead of being copied,
+     * the value is not used by the caller after the call so no reference needs to be kept
+     *
+     * @param int $position
+     * @param mixed $calleeDefinition
+     * @param CompilationContext $compilationContext
+     * @return boolean
+     */
+    protected function isMovableParameter($position, $calleeDefinition, CompilationContext $compilationContext)
+    {
+        if ($compilationContext->backend->getName() != 'ZendEngine3') {
+            return false;
+        }
+
+        /**
+         * Moved parameters are flagged in a 32 bits mask
+         */
+        if ($position >= 32) {
+            return false;
+        }
+
+        /**
+         * Internal methods receive their parameters directly, not through a parameters vector
+         */
+        if ($calleeDefinition instanceof ClassMethod) {
+            return !$calleeDefinition->isInternal();
+        }
+
+        /**
+         * Parameters passed by reference are marked in place by the caller
+         */
+        if ($calleeDefinition instanceof \ReflectionFunctionAbstract) {
+            $reflectionParameters = $calleeDefinition->getParameters();
+            if (isset($reflectionParameters[$position])) {
+                return !$reflectionParameters[$position]->isPassedByReference();
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * Checks if a call can be bound to the direct entry point of an internal method, the number of
+     * parameters passed must be accepted by the method as it would be by the Zend call
+     *
+     * @param ClassMethod $method
+     * @param array $parameters
+     * @param CompilationContext $compilationContext
+     * @param array $expression
+     * @return boolean
+     */
+    public function canCallInternal(ClassMethod $method, $parameters, CompilationContext $compilationContext, array $expression)
+    {
+        $numberParameters = is_array($parameters) ? count($parameters) : 0;
+        if ($numberParameters < $method->getNumberOfRequiredParameters()) {
+            return false;
+        }
+
+        return $numberParameters <= $method->getNumberOfParameters();
+    }
+
+    /**
+     * Returns the C code to pass a compiled expression as a native typed parameter,
+     * or null if the value must be boxed first
+     *
+     * @param CompiledExpression $compiledExpression
+     * @param string $dataType
+     * @param CompilationContext $compilationContext
+     * @return string|null
+     */
+    protected function getTypedParameterCode(CompiledExpression $compiledExpression, $dataType, CompilationContext $compilationContext)
+    {
+        $sourceType = $compiledExpression->getType();
+        $code = $compiledExpression->getCode();
+
+        switch ($sourceType) {
+            case 'null':
+                return '0';
+
+            case 'bool':
+                if ($code == 'true') {
+                    $code = '1';
+                } else if ($code == 'false') {
+                    $code = '0';
+                }
+                break;
+
+            case 'char':
+            case 'uchar':
+                $code = '\'' . $code . '\'';
+                break;
+
+            case 'int':
+            case 'uint':
+            case 'long':
+            case 'double':
+                break;
+
+            case 'variable':
+                $variable = $compilationContext->symbolTable->getVariableForRead($code, $compilationContext, $compiledExpression->getOriginal());
+                $sourceType = $variable->getType();
+                switch ($sourceType) {
+                    case 'int':
+                    case 'uint':
+                    case 'long':
+                    case 'double':
+                    case 'bool':
+                    case 'char':
+                    case 'uchar':
+                        $code = $variable->getName();
+                        break;
+
+                    case 'variable':
+                        return $this->getBoxedTypedParameterCode($compilationContext->backend->getVariableCode($variable), $dataType, $compilationContext);
+
+                    default:
+                        return null;
+                }
+                break;
+
+            default:
+                return null;
+        }
+
+        return $this->castTypedParameterCode($code, $sourceType, $dataType, $compilationContext);
+    }
+
+    /**
+     * Returns the C code converting a zval to a native typed parameter
+     *
+     * @param string $zvalCode
+     * @param string $dataType
+     * @param CompilationContext $compilationContext
+     * @return string
+     */
+    protected function getBoxedTypedParameterCode($zvalCode, $dataType, CompilationContext $compilationContext)
+    {
+        $compilationContext->headersManager->add('kernel/operators');
+        switch ($dataType) {
+            case 'double':
+                return 'zephir_get_doubleval(' . $zvalCode . ')';
+
+            case 'bool':
+                return 'zephir_get_boolval(' . $zvalCode . ')';
+        }
+
+        return $this->castTypedParameterCode('zephir_get_intval(' . $zvalCode . ')', 'long', $dataType, $compilationContext);
+    }
+
+    /**
+     * Converts a native value to the C type of a parameter, conversions to bool follow the PHP truthiness
+     *
+     * @param string $code
+     * @param string $sourceType
+     * @param string $dataType
+     * @param CompilationContext $compilationContext
+     * @return string
+     */
+    protected function castTypedParameterCode($code, $sourceType, $dataType, CompilationContext $compilationContext)
+    {
+        list (, $sourceCType) = $compilationContext->backend->getTypeDefinition($sourceType);
+        list (, $targetCType) = $compilationContext->backend->getTypeDefinition($dataType);
+        if ($sourceCType == $targetCType) {
+            return $code;
+        }
+
+        if ($dataType == 'bool') {
+            return '(' . $code . ' != 0)';
+        }
+
+        return '((' . $targetCType . ') ' . $code . ')';
+    }
+
     /**
      * Resolve parameters using zvals in the stack and without allocating memory for constants
      *
@@ -724,4 +964,14 @@ class Call
     {
         return $this->_mustCheckForCopy;
     }
+
+    /**
+     * Positions of the parameters passed as they are (native values or NULL) in a direct call
+     *
+     * @return array
+     */
+    public function getTypedParameters()
+    {
+        return $this->_typedParams;
+    }
 }
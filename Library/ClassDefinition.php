@@ -664,6 +664,63 @@ class ClassDefinition
         return $this->properties;
     }
 
+    /**
+     * Returns the number of declared properties whose slot offsets are resolved when the class is registered
+     *
+     * @param CompilationContext $compilationContext
+     * @param boolean $static
+     * @return int
+     */
+    public function getPropertyOffsetsCount(CompilationContext $compilationContext, $static = false)
+    {
+        if (!$compilationContext->backend->isZE3() || $this->getType() != 'class' || $this->isExternal()) {
+            return 0;
+        }
+
+        $count = 0;
+        foreach ($this->properties as $property) {
+            if ($property->isStatic() == $static) {
+                $count++;
+            }
+        }
+
+        return $count;
+    }
+
+    /**
+     * Returns the name of the C array holding the slot offsets of the declared properties
+     *
+     * @param boolean $static
+     * @return string
+     */
+    public function getPropertyOffsets($static = false)
+    {
+        return strtolower(str_replace('\\', '_', $this->namespace) . '_' . $this->name) . ($static ? '_static' : '') . '_property_offsets';
+    }
+
+    /**
+     * Returns the C expression with the slot offset of a property declared in this class
+     *
+     * @param string $propertyName
+     * @param boolean $static
+     * @return string|false
+     */
+    public function getPropertyOffset($propertyName, $static = false)
+    {
+        $index = 0;
+        foreach ($this->properties as $name => $property) {
+            if ($property->isStatic() != $static) {
+                continue;
+            }
+            if ($name == $propertyName) {
+                return $this->getPropertyOffsets($static) . '[' . $index . ']';
+            }
+            $index++;
+        }
+
+        return false;
+    }
+
     /**
      * Returns all constants defined in the class
      *
@@ -996,6 +1053,22 @@ class ClassDefinition
          * The ZEPHIR_INIT_CLASS defines properties and constants exported by the class
          */
         $initClassName = $this->getCNamespace() . '_' . $this->getName();
+
+        /**
+         * Slot offsets of the declared properties are resolved when the class is registered
+         */
+        $propertyOffsets = $this->getPropertyOffsetsCount($compilationContext);
+        if ($propertyOffsets) {
+            $codePrinter->output('uint32_t ' . $this->getPropertyOffsets() . '[' . $propertyOffsets . '];');
+            $codePrinter->outputBlankLine();
+        }
+
+        $staticPropertyOffsets = $this->getPropertyOffsetsCount($compilationContext, true);
+        if ($staticPropertyOffsets) {
+            $codePrinter->output('uint32_t ' . $this->getPropertyOffsets(true) . '[' . $staticPropertyOffsets . '];');
+            $codePrinter->outputBlankLine();
+        }
+
         $codePrinter->output('ZEPHIR_INIT_CLASS(' . $initClassName . ') {');
         $codePrinter->outputBlankLine();
 
@@ -1073,6 +1146,18 @@ class ClassDefinition
             $codePrinter->outputBlankLine();
         }
 
+        if ($propertyOffsets || $staticPropertyOffsets) {
+            $compilationContext->headersManager->add('kernel/object');
+            foreach ($this->getProperties() as $property) {
+                if ($property->isStatic()) {
+                    $codePrinter->output($this->getPropertyOffset($property->getName(), true) . ' = zephir_get_static_property_offset(' . $this->getClassEntry() . ', SL("' . $property->getName() . '"));');
+                } else {
+                    $codePrinter->output($this->getPropertyOffset($property->getName()) . ' = zephir_get_property_offset(' . $this->getClassEntry() . ', SL("' . $property->getName() . '"));');
+                }
+            }
+            $codePrinter->outputBlankLine();
+        }
+
         $initMethod = $this->getInitMethod();
         if ($initMethod) {
             $codePrinter->output($namespace . '_' . strtolower($this->getSCName($namespace)) . '_ce->create_object = ' . $initMethod->getName() . ';');
@@ -1219,6 +1304,16 @@ class ClassDefinition
         $codePrinter->output($exportAPI . ' zend_class_entry *' . $this->getClassEntry() . ';');
         $codePrinter->outputBlankLine();
 
+        if ($propertyOffsets) {
+            $codePrinter->output($exportAPI . ' uint32_t ' . $this->getPropertyOffsets() . '[' . $propertyOffsets . '];');
+        }
+        if ($staticPropertyOffsets) {
+            $codePrinter->output($exportAPI . ' uint32_t ' . $this->getPropertyOffsets(true) . '[' . $staticPropertyOffsets . '];');
+        }
+        if ($propertyOffsets || $staticPropertyOffsets) {
+            $codePrinter->outputBlankLine();
+        }
+
         $codePrinter->output('ZEPHIR_INIT_CLASS(' . $this->getCNamespace() . '_' . $this->getName() . ');');
         $codePrinter->outputBlankLine();
 
@@ -351,8 +351,17 @@ class ClassMethod
      */
     public function setupOptimized(CompilationContext $compilationContext)
     {
-        if (!$compilationContext->config->get('internal-call-transformation', 'optimizations')) {
-            return;
+        $config = $compilationContext->config;
+        if (!$config->get('internal-call-transformation', 'optimizations')) {
+            if ($this->isPrivate()) {
+                if (!$config->get('private-internal-methods', 'optimizations')) {
+                    return;
+                }
+            } else {
+                if (!$config->get('public-internal-methods', 'optimizations')) {
+                    return;
+                }
+            }
         }
         $classDefinition = $this->getClassDefinition();
         /* Skip for closures */
@@ -364,12 +373,19 @@ class ClassMethod
             if ($this->getNumberOfRequiredParameters() != $this->getNumberOfParameters()) {
                 return $this;
             }
-            if ($this->isConstructor()) {
+            if ($this->isConstructor() || $this->isAbstract()) {
+                return $this;
+            }
+            /* Only methods that can be bound at compile time are called directly */
+            if (!$this->isStaticallyResolvable() && !$this->isStatic()) {
                 return $this;
             }
             $optimizedName = $this->getName() . '_zephir_internal_call';
 
             $visibility = array('internal');
+            if ($this->isStatic()) {
+                $visibility[] = 'static';
+            }
 
             $statements = null;
             if ($this->statements) {
@@ -393,6 +409,55 @@ class ClassMethod
     }
     public $optimizable = true;
 
+    /**
+     * Checks whether a call to this method on an instance can be bound at compile time,
+     * this is, the method cannot be overriden by a child class
+     *
+     * @return boolean
+     */
+    public function isStaticallyResolvable()
+    {
+        if ($this->isPrivate() || $this->isFinal()) {
+            return true;
+        }
+        return $this->classDefinition->isFinal();
+    }
+
+    /**
+     * Checks whether a parameter is received as a native C value in the internal (direct call) signature.
+     * Optional and strict typed parameters keep receiving a zval, the callee assigns their default value
+     * or checks their type as it does for the other methods
+     *
+     * @param array $parameter
+     * @param CompilationContext $compilationContext
+     * @return boolean
+     */
+    public function isTypedInternalParameter(array $parameter, CompilationContext $compilationContext)
+    {
+        if (!$this->isInternal() || !$compilationContext->backend->isZE3()) {
+            return false;
+        }
+
+        if (isset($parameter['default']) || (isset($parameter['mandatory']) && $parameter['mandatory'])) {
+            return false;
+        }
+
+        if (isset($parameter['data-type'])) {
+            switch ($parameter['data-type']) {
+                case 'int':
+                case 'uint':
+                case 'long':
+                case 'double':
+                case 'bool':
+                case 'char':
+                case 'uchar':
+                    return true;
+            }
+        }
+
+        return false;
+    }
+
     public function getOptimizedMethod()
     {
         $optimizedName = $this->getName() . '_zephir_internal_call';
@@ -1525,6 +1590,8 @@ class ClassMethod
          * Reset try/catch and loop counter
          */
         $compilationContext->insideCycle = 0;
+        $compilationContext->grownStrings = array();
+        $compilationContext->growableStrings = array();
         $compilationContext->insideTryCatch = 0;
         $compilationContext->currentTryCatch = 0;
 
@@ -1572,6 +1639,10 @@ class ClassMethod
 
                         default:
                             $symbol = $symbolTable->addVariable($parameter['data-type'], $parameter['name'], $compilationContext);
+                            /* Scalars in direct calls are received as native C values */
+                            if ($this->isTypedInternalParameter($parameter, $compilationContext)) {
+                                break;
+                            }
                             $symbolParam = $symbolTable->addVariable('variable', $parameter['name'] . '_param', $compilationContext);
                             /* TODO: Move this to the respective backend, which requires refactoring how this works */
                             if ($compilationContext->backend->isZE3()) {
@@ -1813,6 +1884,7 @@ class ClassMethod
              * Round 2. Fetch the parameters in the method
              */
             $params = array();
+            $typedParams = array();
             $requiredParams = array();
             $optionalParams = array();
             $numberRequiredParams = 0;
@@ -1840,7 +1912,11 @@ class ClassMethod
                         if (!$this->isInternal()) {
                             $params[] = '&' . $parameter['name'] . '_param';
                         } else {
-                            $params[] = $parameter['name'] . '_param';
+                            if ($this->isTypedInternalParameter($parameter, $compilationContext)) {
+                                $typedParams[] = $parameter['name'];
+                            } else {
+                                $params[] = $parameter['name'] . '_param';
+                            }
                         }
                         break;
                 }
@@ -1912,7 +1988,7 @@ class ClassMethod
                     $dataType = 'variable';
                 }
 
-                if ($dataType != 'variable') {
+                if ($dataType != 'variable' && !$this->isTypedInternalParameter($parameter, $compilationContext)) {
                     /**
                      * Assign value from zval to low level type
                      */
@@ -2018,6 +2094,9 @@ class ClassMethod
                     $code .= "\t" . $tempCodePrinter->getOutput() . PHP_EOL;
                     $compilationContext->codePrinter = $realCodePrinter;
                 }
+                foreach ($typedParams as $typedParam) {
+                    $code .= "\t" . $typedParam . ' = ' . $typedParam . '_param_ext;' . PHP_EOL;
+                }
             }
             $code .= PHP_EOL;
         }
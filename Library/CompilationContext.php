@@ -115,6 +115,20 @@ class CompilationContext
      */
     public $insideCycle = 0;
 
+    /**
+     * Variables appended to with spare capacity inside the current loops
+     *
+     * @var Variable[]
+     */
+    public $grownStrings = array();
+
+    /**
+     * Variables the outermost loop being compiled only appends to or assigns
+     *
+     * @var boolean[]
+     */
+    public $growableStrings = array();
+
     /**
      * Tells if the the compilation is being made inside a try/catch block
      *
@@ -739,6 +739,15 @@ class Compiler
          */
         $namespace = $this->checkDirectory();
 
+        /**
+         * Interned strings are exported by the extension, their symbols are prefixed with its name
+         */
+        $extensionName = $this->config->get('extension-name');
+        if (empty($extensionName) || !is_string($extensionName)) {
+            $extensionName = str_replace('\\', '_', $namespace);
+        }
+        $this->stringManager->setSymbolPrefix($extensionName);
+
         /**
          * Check whether there are external dependencies
          */
@@ -1328,6 +1337,12 @@ class Compiler
          */
         $extraLibs = $this->config->get('extra-libs');
         $extraCflags = $this->config->get('extra-cflags');
+        if ($this->config->get('fcall-profiling')) {
+            /**
+             * Dynamic calls report their call sites when the extension is shut down, ZTS builds ignore it
+             */
+            $extraCflags = trim($extraCflags . ' -DZEPHIR_FCALL_PROFILE');
+        }
         $contentM4 = $this->generatePackageDependenciesM4($contentM4);
 
         /**
@@ -1830,6 +1845,19 @@ class Compiler
          */
         $phpInfo = $this->processExtensionInfo();
 
+        /**
+         * Constant property/array-key names and string literals are created once as interned strings
+         */
+        $internedEntries = array();
+        $internedInits = array();
+        $internedHeaders = array();
+        foreach ($this->stringManager->getInternedStrings() as $internedString) {
+            $symbol = $this->stringManager->getInternedStringSymbol($internedString);
+            $internedEntries[] = 'zend_string *' . $symbol . ';';
+            $internedInits[] = $symbol . ' = zephir_interned_string_init(SL("' . $internedString . '"));';
+            $internedHeaders[] = 'extern zend_string *' . $symbol . ';';
+        }
+
         /**
          * Round 5. Generate Function entries (FE)
          */
@@ -1884,6 +1912,8 @@ class Compiler
                 PHP_EOL . "\t",
                 array_merge($completeInterfaceInits, $completeClassInits)
             ),
+            '%INTERNED_STRINGS%'    => implode(PHP_EOL, $internedEntries),
+            '%INTERNED_STRINGS_INITS%' => implode(PHP_EOL . "\t", $internedInits),
             '%INIT_GLOBALS%'        => $globalsDefault,
             '%EXTENSION_INFO%'      => $phpInfo,
             '%EXTRA_INCLUDES%'      => $includes,
@@ -1937,7 +1967,8 @@ class Compiler
         }
 
         $toReplace = array(
-            '%INCLUDE_HEADERS%' => implode(PHP_EOL, $includeHeaders)
+            '%INTERNED_STRINGS%' => implode(PHP_EOL, $internedHeaders),
+            '%INCLUDE_HEADERS%'  => implode(PHP_EOL, $includeHeaders)
         );
 
         foreach ($toReplace as $mark => $replace) {
@@ -84,8 +84,11 @@ class Config
             'static-constant-class-folding'      => true,
             'call-gatherer-pass'                 => true,
             'check-invalid-reads'                => false,
-            'internal-call-transformation'       => false
+            'internal-call-transformation'       => false,
+            'private-internal-methods'           => false,
+            'public-internal-methods'            => false
         ),
+        'fcall-profiling' => false,
         'namespace'   => '',
         'name'        => '',
         'description' => '',
@@ -141,6 +141,28 @@ class NativeArrayAccess
         return new CompiledExpression('variable', $symbolVariable->getName(), $expression);
     }
 
+    /**
+     * Reads an element of a native typed array, the result is a scalar of the element type
+     *
+     * @param array $expression
+     * @param Variable $variableVariable
+     * @param CompilationContext $compilationContext
+     * @return CompiledExpression
+     */
+    protected function _accessNativeArray($expression, Variable $variableVariable, CompilationContext $compilationContext)
+    {
+        $expr = new Expression($expression['right']);
+        $exprIndex = $expr->compile($compilationContext);
+
+        $backend = $compilationContext->backend;
+        $index = $backend->getNativeArrayIndex($exprIndex, $compilationContext, $expression['right']);
+
+        $compilationContext->headersManager->add('kernel/array');
+        $elementType = $variableVariable->getNativeArrayElementType();
+
+        return new CompiledExpression($elementType, 'zephir_native_' . $elementType . '_get(' . $backend->getVariableCode($variableVariable) . ', ' . $index . ')', $expression);
+    }
+
     /**
      * @param array $expression
      * @param Variable $variableVariable
@@ -307,6 +329,9 @@ class NativeArrayAccess
                     case 'variable':
                     case 'array':
                     case 'string':
+                    case 'int[]':
+                    case 'double[]':
+                    case 'bool[]':
                         break;
 
                     default:
@@ -330,6 +355,9 @@ class NativeArrayAccess
 
             case 'string':
                 return $this->_accessStringOffset($expression, $variableVariable, $compilationContext);
+
+            default:
+                return $this->_accessNativeArray($expression, $variableVariable, $compilationContext);
         }
     }
 }
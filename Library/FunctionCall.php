@@ -20,6 +20,7 @@
 namespace Zephir;
 
 use Zephir\Utils;
+use Zephir\Cache\SlotsCache;
 use Zephir\Optimizers\OptimizerAbstract;
 
 /**
@@ -268,6 +269,60 @@ class FunctionCall extends Call
         return false;
     }
 
+    /**
+     * Checks if the function can be called through the internal function fast path,
+     * this is, functions implemented in C that don't receive parameters by reference
+     * and don't inspect the frame of their caller
+     *
+     * @param string $funcName
+     * @param CompilationContext $compilationContext
+     * @return boolean
+     */
+    protected function isInternalFastCall($funcName, CompilationContext $compilationContext)
+    {
+        if (!$compilationContext->backend->isZE3() || $this->isBuiltInFunction($funcName)) {
+            return false;
+        }
+
+        switch (strtolower($funcName)) {
+            case 'compact':
+            case 'extract':
+            case 'func_get_arg':
+            case 'func_get_args':
+            case 'func_num_args':
+            case 'get_defined_vars':
+            case 'get_called_class':
+            case 'get_class':
+            case 'get_parent_class':
+            case 'call_user_func':
+            case 'call_user_func_array':
+            case 'forward_static_call':
+            case 'forward_static_call_array':
+            case 'debug_backtrace':
+            case 'debug_print_backtrace':
+            case 'parse_str':
+            case 'mb_parse_str':
+            case 'assert':
+                return false;
+        }
+
+        /**
+         * Deprecated functions are called through the executor, which raises their notice
+         */
+        $reflector = $this->getReflector($funcName);
+        if (!$reflector || !$reflector->isInternal() || $reflector->isDeprecated()) {
+            return false;
+        }
+
+        foreach ($reflector->getParameters() as $parameter) {
+            if ($parameter->isPassedByReference()) {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     /**
      * Checks if a function exists or is a built-in Zephir function
      *
@@ -337,7 +392,7 @@ class FunctionCall extends Call
             if ($readOnly) {
                 $params = $this->getReadOnlyResolvedParams($expression['parameters'], $compilationContext, $expression);
             } else {
-                $params = $this->getResolvedParams($expression['parameters'], $compilationContext, $expression);
+                $params = $this->getResolvedParams($expression['parameters'], $compilationContext, $expression, $this->getReflector($funcName));
             }
         } else {
             $params = array();
@@ -385,8 +440,19 @@ class FunctionCall extends Call
         /**
          * Check if the function can have an inline cache
          */
-        $functionCache = $compilationContext->cacheManager->getFunctionCache();
-        $cachePointer = $functionCache->get($funcName, $compilationContext, $this, $exists);
+        if ($exists && $this->isInternalFastCall($funcName, $compilationContext)) {
+            /**
+             * Functions implemented in C are invoked directly through their handler,
+             * the kernel resolves them by their lowercased name
+             */
+            $funcName = strtolower($funcName);
+            $macro = 'INTERNAL_FUNCTION';
+            $cachePointer = SlotsCache::getFunctionSlot($funcName);
+        } else {
+            $macro = 'FUNCTION';
+            $functionCache = $compilationContext->cacheManager->getFunctionCache();
+            $cachePointer = $functionCache->get($funcName, $compilationContext, $this, $exists);
+        }
 
         /**
          * Add the last call status to the current symbol table
@@ -396,30 +462,30 @@ class FunctionCall extends Call
         if (!count($params)) {
             if ($this->isExpectingReturn()) {
                 if ($symbolVariable->getName() == 'return_value') {
-                    $codePrinter->output('ZEPHIR_RETURN_CALL_FUNCTION("' . $funcName . '", ' . $cachePointer . ');');
+                    $codePrinter->output('ZEPHIR_RETURN_CALL_' . $macro . '("' . $funcName . '", ' . $cachePointer . ');');
                 } else {
                     if ($this->mustInitSymbolVariable()) {
                         $symbolVariable->setMustInitNull(true);
                         $symbolVariable->trackVariant($compilationContext);
                     }
-                    $codePrinter->output('ZEPHIR_CALL_FUNCTION(' . $symbol . ', "' . $funcName . '", ' . $cachePointer . ');');
+                    $codePrinter->output('ZEPHIR_CALL_' . $macro . '(' . $symbol . ', "' . $funcName . '", ' . $cachePointer . ');');
                 }
             } else {
-                $codePrinter->output('ZEPHIR_CALL_FUNCTION(NULL, "' . $funcName . '", ' . $cachePointer . ');');
+                $codePrinter->output('ZEPHIR_CALL_' . $macro . '(NULL, "' . $funcName . '", ' . $cachePointer . ');');
             }
         } else {
             if ($this->isExpectingReturn()) {
                 if ($symbolVariable->getName() == 'return_value') {
-                    $codePrinter->output('ZEPHIR_RETURN_CALL_FUNCTION("' . $funcName . '", ' . $cachePointer . ', ' . join(', ', $params) . ');');
+                    $codePrinter->output('ZEPHIR_RETURN_CALL_' . $macro . '("' . $funcName . '", ' . $cachePointer . ', ' . join(', ', $params) . ');');
                 } else {
                     if ($this->mustInitSymbolVariable()) {
                         $symbolVariable->setMustInitNull(true);
                         $symbolVariable->trackVariant($compilationContext);
                     }
-                    $codePrinter->output('ZEPHIR_CALL_FUNCTION(' . $symbol . ', "' . $funcName . '", ' . $cachePointer . ', ' . join(', ', $params) . ');');
+                    $codePrinter->output('ZEPHIR_CALL_' . $macro . '(' . $symbol . ', "' . $funcName . '", ' . $cachePointer . ', ' . join(', ', $params) . ');');
                 }
             } else {
-                $codePrinter->output('ZEPHIR_CALL_FUNCTION(NULL, "' . $funcName . '", ' . $cachePointer . ', ' . join(', ', $params) . ');');
+                $codePrinter->output('ZEPHIR_CALL_' . $macro . '(NULL, "' . $funcName . '", ' . $cachePointer . ', ' . join(', ', $params) . ');');
             }
         }
 
@@ -445,11 +445,44 @@ class MethodCall extends Call
          */
         $compilationContext->symbolTable->mustGrownStack(true);
 
+        /**
+         * Methods that cannot be overriden are called directly bypassing the Zend call frame
+         */
+        $directMethod = null;
+        if ($type == self::CALL_NORMAL || $type == self::CALL_DYNAMIC_STRING) {
+            $realMethod = $this->getRealCalledMethod($compilationContext, $variableVariable, $methodName);
+            if ($realMethod[1] instanceof ClassMethod) {
+                $callParameters = isset($expression['parameters']) ? $expression['parameters'] : array();
+                if ($realMethod[1]->isInternal()) {
+                    /* Internal methods don't have an entry in the function table */
+                    if ($realMethod[0] > 1) {
+                        throw new CompilerException("Cannot resolve method: '" . $expression['name'] . "' in polymorphic variable", $expression);
+                    }
+                    if (!$this->canCallInternal($realMethod[1], $callParameters, $compilationContext, $expression)) {
+                        throw new CompilerException("Invalid parameters passed to internal method: '" . $expression['name'] . "'", $expression);
+                    }
+                    $directMethod = $realMethod[1];
+                } else {
+                    if ($variableVariable->getRealName() == 'this' && !$realMethod[1]->isStatic() && $realMethod[1]->isStaticallyResolvable()) {
+                        $optimizedMethod = $realMethod[1]->getOptimizedMethod();
+                        if ($optimizedMethod->isInternal() && $this->canCallInternal($optimizedMethod, $callParameters, $compilationContext, $expression)) {
+                            $directMethod = $optimizedMethod;
+                        }
+                    }
+                }
+            }
+        }
+
         /**
          * Mark references
          */
-        if (isset($expression['parameters'])) {
-            $params = $this->getResolvedParams($expression['parameters'], $compilationContext, $expression, isset($method) ? $method : null);
+        if (isset($expression['parameters']) || $directMethod) {
+            if ($directMethod) {
+                /* Direct calls are resolved even without parameters to pass the omitted ones */
+                $params = $this->getResolvedParams(isset($expression['parameters']) ? $expression['parameters'] : array(), $compilationContext, $expression, $directMethod);
+            } else {
+                $params = $this->getResolvedParams($expression['parameters'], $compilationContext, $expression, isset($method) ? $method : null);
+            }
             if (count($references)) {
                 foreach ($params as $position => $param) {
                     if (isset($references[$position])) {
@@ -571,19 +604,7 @@ class MethodCall extends Call
 
         // Generate the code according to the call type
         if ($type == self::CALL_NORMAL || $type == self::CALL_DYNAMIC_STRING) {
-            $realMethod = $this->getRealCalledMethod($compilationContext, $variableVariable, $methodName);
-
-            $isInternal = false;
-            if (is_object($realMethod[1])) {
-                $realMethod[1] = $realMethod[1]->getOptimizedMethod();
-                $method = $realMethod[1];
-                $isInternal = $realMethod[1]->isInternal();
-                if ($isInternal && $realMethod[0] > 1) {
-                    throw new CompilerException("Cannot resolve method: '" . $expression['name'] . "' in polymorphic variable", $expression);
-                }
-            }
-
-            if (!$isInternal) {
+            if (!$directMethod) {
                 // Check if the method call can have an inline cache
                 $methodCache = $compilationContext->cacheManager->getMethodCache();
 
@@ -602,18 +623,19 @@ class MethodCall extends Call
                 $variableCode = $compilationContext->backend->getVariableCode($variableVariable);
                 $paramCount = count($params);
                 $paramsStr = $paramCount ? ', ' . join(', ', $params) : '';
+                $typedParams = $this->getTypedParameters();
 
                 if ($isExpecting) {
                     if ($symbolVariable->getName() == 'return_value') {
-                        $macro = $compilationContext->backend->getFcallManager()->getMacro(false, true, $paramCount);
-                        $codePrinter->output($macro . '(' . $variableCode . ', ' . $method->getInternalName() . $paramsStr . ');');
+                        $macro = $compilationContext->backend->getFcallManager()->getMacro(false, true, $paramCount, $typedParams);
+                        $codePrinter->output($macro . '(' . $variableCode . ', ' . $directMethod->getInternalName() . $paramsStr . ');');
                     } else {
-                        $macro = $compilationContext->backend->getFcallManager()->getMacro(false, 2, $paramCount);
-                        $codePrinter->output($macro . '(' . $symbolCode . ', ' . $variableCode . ', ' . $method->getInternalName() . $paramsStr . ');');
+                        $macro = $compilationContext->backend->getFcallManager()->getMacro(false, 2, $paramCount, $typedParams);
+                        $codePrinter->output($macro . '(' . $symbolCode . ', ' . $variableCode . ', ' . $directMethod->getInternalName() . $paramsStr . ');');
                     }
                 } else {
-                    $macro = $compilationContext->backend->getFcallManager()->getMacro(false, false, $paramCount);
-                    $codePrinter->output($macro . '(' . $variableCode . ', ' . $method->getInternalName() . $paramsStr . ');');
+                    $macro = $compilationContext->backend->getFcallManager()->getMacro(false, false, $paramCount, $typedParams);
+                    $codePrinter->output($macro . '(' . $variableCode . ', ' . $directMethod->getInternalName() . $paramsStr . ');');
                 }
             }
         } else {
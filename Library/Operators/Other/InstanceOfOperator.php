@@ -25,6 +25,7 @@ use Zephir\Expression;
 use Zephir\CompilerException;
 use Zephir\CompiledExpression;
 use Zephir\Utils;
+use Zephir\Cache\SlotsCache;
 
 /**
  * InstanceOf
@@ -134,6 +135,9 @@ class InstanceOfOperator extends BaseOperator
         $context->headersManager->add('kernel/object');
         $symbol = $context->backend->getVariableCode($symbolVariable);
         if (isset($code)) {
+            if ($context->backend->isZE3()) {
+                return new CompiledExpression('bool', 'zephir_is_instance_of_cached(' . $symbol . ', ' . $code . ', ' . SlotsCache::getClassEntrySlot() . ')', $expression);
+            }
             return new CompiledExpression('bool', 'zephir_is_instance_of(' . $symbol . ', ' . $code . ' TSRMLS_CC)', $expression);
         }
 
@@ -49,6 +49,23 @@ class ArrayMergeOptimizer extends OptimizerAbstract
             return false;
         }
 
+        /**
+         * let a = array_merge(a, b) extends a in place instead of building a new array
+         */
+        if ($context->backend->isZE3()) {
+            $target = $call->getExpectingVariable();
+            $parameter = $expression['parameters'][0]['parameter'];
+            if (is_object($target) && in_array($target->getType(), array('variable', 'array')) && $parameter['type'] == 'variable' && $parameter['value'] == $target->getName()) {
+                $context->headersManager->add('kernel/array');
+
+                $resolvedParams = $call->getReadOnlyResolvedParams($expression['parameters'], $context, $expression);
+                $context->codePrinter->output('zephir_fast_array_merge_self(' . $resolvedParams[0] . ', ' . $resolvedParams[1] . ');');
+
+                $target->setDynamicTypes('array');
+                return new CompiledExpression('variable', $target->getRealName(), $expression);
+            }
+        }
+
         /**
          * Process the expected symbol to be returned
          */
@@ -23,6 +23,7 @@ use Zephir\Call;
 use Zephir\CompilationContext;
 use Zephir\CompilerException;
 use Zephir\CompiledExpression;
+use Zephir\Cache\SlotsCache;
 use Zephir\Optimizers\OptimizerAbstract;
 
 /**
@@ -81,7 +82,11 @@ class CallUserFuncArrayOptimizer extends OptimizerAbstract
             $symbolVariable->initVariant($context);
         }
         
-        $context->codePrinter->output('ZEPHIR_CALL_USER_FUNC_ARRAY(' . $symbolVariable->getName() . ', ' . $resolvedParams[0] . ', ' . $resolvedParams[1] . ');');
+        if ($context->backend->isZE3()) {
+            $context->codePrinter->output('ZEPHIR_CALL_USER_FUNC_ARRAY(' . $context->backend->getVariableCode($symbolVariable) . ', ' . $resolvedParams[0] . ', ' . $resolvedParams[1] . ', ' . SlotsCache::getCallableSlot() . ');');
+        } else {
+            $context->codePrinter->output('ZEPHIR_CALL_USER_FUNC_ARRAY(' . $symbolVariable->getName() . ', ' . $resolvedParams[0] . ', ' . $resolvedParams[1] . ');');
+        }
         $call->addCallStatusOrJump($context);
 
         return new CompiledExpression('variable', $symbolVariable->getName(), $expression);
@@ -23,6 +23,7 @@ use Zephir\Call;
 use Zephir\CompilationContext;
 use Zephir\CompilerException;
 use Zephir\CompiledExpression;
+use Zephir\Cache\SlotsCache;
 use Zephir\Optimizers\OptimizerAbstract;
 
 /**
@@ -81,7 +82,11 @@ class CallUserFuncOptimizer extends OptimizerAbstract
             $symbolVariable->initVariant($context);
         }
         
-        $context->codePrinter->output('ZEPHIR_CALL_USER_FUNC(' . $symbolVariable->getName() . ', ' . $resolvedParams[0] . ');');
+        if ($context->backend->isZE3()) {
+            $context->codePrinter->output('ZEPHIR_CALL_USER_FUNC(' . $context->backend->getVariableCode($symbolVariable) . ', ' . $resolvedParams[0] . ', ' . SlotsCache::getCallableSlot() . ');');
+        } else {
+            $context->codePrinter->output('ZEPHIR_CALL_USER_FUNC(' . $symbolVariable->getName() . ', ' . $resolvedParams[0] . ');');
+        }
         $call->addCallStatusOrJump($context);
 
         return new CompiledExpression('variable', $symbolVariable->getName(), $expression);
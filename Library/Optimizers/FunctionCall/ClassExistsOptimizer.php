@@ -24,6 +24,7 @@ use Zephir\CompilationContext;
 use Zephir\CompilerException;
 use Zephir\CompiledExpression;
 use Zephir\Optimizers\OptimizerAbstract;
+use Zephir\Cache\SlotsCache;
 
 /**
  * ClassExistsOptimizer
@@ -63,6 +64,10 @@ class ClassExistsOptimizer extends OptimizerAbstract
 
         $context->headersManager->add('kernel/object');
 
+        if ($context->backend->isZE3()) {
+            return new CompiledExpression('bool', 'zephir_class_exists_cached(' . $resolvedParams[0] . ', ' . $autoload . ', ' . SlotsCache::getClassEntrySlot() . ')', $expression);
+        }
+
         return new CompiledExpression('bool', 'zephir_class_exists(' . $resolvedParams[0] . ', ' . $autoload . ' TSRMLS_CC)', $expression);
     }
 }
@@ -48,6 +48,18 @@ class CountOptimizer extends OptimizerAbstract
             return false;
         }
 
+        /**
+         * Native typed arrays know their length without a hash table
+         */
+        $parameter = $expression['parameters'][0]['parameter'];
+        if ($parameter['type'] == 'variable' && $context->symbolTable->hasVariable($parameter['value'])) {
+            $symbolVariable = $context->symbolTable->getVariableForRead($parameter['value'], $context, $expression);
+            if ($symbolVariable->isNativeArray()) {
+                $context->headersManager->add('kernel/array');
+                return new CompiledExpression('int', 'zephir_native_' . $symbolVariable->getNativeArrayElementType() . '_count(' . $context->backend->getVariableCode($symbolVariable) . ')', $expression);
+            }
+        }
+
         $resolvedParams = $call->getReadOnlyResolvedParams($expression['parameters'], $context, $expression);
         return new CompiledExpression('int', 'zephir_fast_count_int(' . $resolvedParams[0] . ' TSRMLS_CC)', $expression);
     }
@@ -24,6 +24,7 @@ use Zephir\CompilationContext;
 use Zephir\CompilerException;
 use Zephir\CompiledExpression;
 use Zephir\Optimizers\OptimizerAbstract;
+use Zephir\Cache\SlotsCache;
 
 /**
  * CreateInstanceOptimizer
@@ -79,7 +80,11 @@ class CreateInstanceOptimizer extends OptimizerAbstract
         $call->addCallStatusFlag($context);
 
         $symbol = $context->backend->getVariableCode($symbolVariable);
-        $context->codePrinter->output('ZEPHIR_LAST_CALL_STATUS = zephir_create_instance(' . $symbol . ', ' . $resolvedParams[0] . ' TSRMLS_CC);');
+        if ($context->backend->isZE3()) {
+            $context->codePrinter->output('ZEPHIR_LAST_CALL_STATUS = zephir_create_instance_cached(' . $symbol . ', ' . $resolvedParams[0] . ', ' . SlotsCache::getClassEntrySlot() . ');');
+        } else {
+            $context->codePrinter->output('ZEPHIR_LAST_CALL_STATUS = zephir_create_instance(' . $symbol . ', ' . $resolvedParams[0] . ' TSRMLS_CC);');
+        }
 
         $call->checkTempParameters($context);
         $call->addCallStatusOrJump($context);
@@ -45,7 +45,23 @@ class Md5Optimizer extends OptimizerAbstract
             return false;
         }
 
-        if (count($expression['parameters']) != 1) {
+        /**
+         * The raw digest is only produced by the ZendEngine3 kernel and only for a literal flag
+         */
+        $function = 'zephir_md5';
+        if (count($expression['parameters']) == 2) {
+            $rawOutput = $expression['parameters'][1]['parameter'];
+            if ($rawOutput['type'] != 'bool') {
+                return false;
+            }
+            if ($rawOutput['value'] == 'true') {
+                if (!$context->backend->isZE3()) {
+                    return false;
+                }
+                $function = 'zephir_md5_raw';
+            }
+            unset($expression['parameters'][1]);
+        } else if (count($expression['parameters']) != 1) {
             return false;
         }
 
@@ -68,7 +84,7 @@ class Md5Optimizer extends OptimizerAbstract
             $symbolVariable->initVariant($context);
         }
         $symbol = $context->backend->getVariableCode($symbolVariable);
-        $context->codePrinter->output('zephir_md5(' . $symbol . ', ' . $resolvedParams[0] . ');');
+        $context->codePrinter->output($function . '(' . $symbol . ', ' . $resolvedParams[0] . ');');
         return new CompiledExpression('variable', $symbolVariable->getRealName(), $expression);
     }
 }
@@ -53,6 +53,8 @@ class PregMatchOptimizer extends OptimizerAbstract
             return false;
         }
 
+        $constantPattern = $expression['parameters'][0]['parameter']['type'] == 'string';
+
         /**
          * Process the matches result
          */
@@ -121,6 +123,20 @@ class PregMatchOptimizer extends OptimizerAbstract
         }
         $symbol = $context->backend->getVariableCode($symbolVariable);
         $matchesSymbol = $context->backend->getVariableCode($matchesVariable);
+
+        /**
+         * A constant pattern is compiled once and kept in a static slot owned by the call site
+         */
+        if ($constantPattern && $context->backend->isZE3()) {
+            $context->codePrinter->output('{');
+            $context->codePrinter->increaseLevel();
+            $context->codePrinter->output('static zephir_pcre_slot pcre_slot;');
+            $context->codePrinter->output('zephir_preg_match_cached(' . $symbol . ', &pcre_slot, ' . $resolvedParams[0] . ', ' . $resolvedParams[1] . ', ' . $matchesSymbol . ', ' . $this::GLOBAL_MATCH . ', ' . $flags . ', ' . $offset . ');');
+            $context->codePrinter->decreaseLevel();
+            $context->codePrinter->output('}');
+            return new CompiledExpression('variable', $symbolVariable->getRealName(), $expression);
+        }
+
         $context->codePrinter->output('zephir_preg_match(' . $symbol . ', ' . $resolvedParams[0] . ', ' . $resolvedParams[1] . ', ' . $matchesSymbol . ', ' . $this::GLOBAL_MATCH . ', ' . $flags . ', ' . $offset . ' TSRMLS_CC);');
         return new CompiledExpression('variable', $symbolVariable->getRealName(), $expression);
     }
@@ -54,6 +54,13 @@ class DeclareStatement extends StatementAbstract
 
             $currentType = $statement['data-type'];
 
+            /**
+             * Native typed arrays are only implemented by the ZendEngine3 kernel, other backends use plain arrays
+             */
+            if (in_array($currentType, array('int[]', 'double[]', 'bool[]')) && !$compilationContext->backend->isZE3()) {
+                $currentType = 'array';
+            }
+
             /**
              * Replace original data type by the pre-processed infered type
              */
@@ -113,6 +120,13 @@ class DeclareStatement extends StatementAbstract
                 $letStatement->compile($compilationContext);
             } else {
                 $symbolVariable->enableDefaultAutoInitValue();
+
+                /**
+                 * Native arrays are tracked from the start so appending to them never leaks the buffer
+                 */
+                if ($symbolVariable->isNativeArray()) {
+                    $symbolVariable->initVariant($compilationContext);
+                }
             }
         }
     }
@@ -41,6 +41,8 @@ class DoWhileStatement extends StatementAbstract
 
         $codePrinter->output('do {');
 
+        $compilationContext->backend->onLoopEnter($this->_statement, $compilationContext);
+
         /**
          * Variables are initialized in a different way inside cycle
          */
@@ -68,5 +70,7 @@ class DoWhileStatement extends StatementAbstract
          * Compound conditions can be evaluated in a single line of the C-code
          */
         $codePrinter->output('} while (' . $condition . ');');
+
+        $compilationContext->backend->onLoopExit($compilationContext);
     }
 }
@@ -188,6 +188,8 @@ class ForStatement extends StatementAbstract
         $codePrinter->output('if (' . $condition . ') {');
         $codePrinter->increaseLevel();
 
+        $compilationContext->backend->onLoopEnter($this->_statement, $compilationContext);
+
         /**
          * Inside a cycle
          */
@@ -398,6 +400,8 @@ class ForStatement extends StatementAbstract
         $codePrinter->decreaseLevel();
 
         $codePrinter->output('}');
+
+        $compilationContext->backend->onLoopExit($compilationContext);
     }
 
     /**
@@ -476,6 +480,8 @@ class ForStatement extends StatementAbstract
             $variable->setDynamicTypes('undefined');
         }
 
+        $compilationContext->backend->onLoopEnter($this->_statement, $compilationContext);
+
         /**
          * Variables are initialized in a different way inside cycle
          */
@@ -523,6 +529,8 @@ class ForStatement extends StatementAbstract
         $codePrinter->output('}');
 
         $compilationContext->backend->destroyIterator($iteratorVariable, $compilationContext);
+
+        $compilationContext->backend->onLoopExit($compilationContext);
     }
 
     /**
@@ -618,6 +626,8 @@ class ForStatement extends StatementAbstract
         $compilationContext->headersManager->add('kernel/operators');
         $codePrinter->output("\t" . $variable->getName() . ' = ZEPHIR_STRING_OFFSET(' . $stringVariableCode . ', ' . $tempVariable->getName() . ');');
 
+        $compilationContext->backend->onLoopEnter($this->_statement, $compilationContext);
+
         /**
          * Variables are initialized in a different way inside cycle
          */
@@ -639,6 +649,89 @@ class ForStatement extends StatementAbstract
         $compilationContext->insideCycle--;
 
         $codePrinter->output('}');
+
+        $compilationContext->backend->onLoopExit($compilationContext);
+    }
+
+    /**
+     * Compiles traversing of native typed arrays
+     *
+     * - A key must be an integer or a zval
+     * - A value must be a scalar of the element type or a zval
+     *
+     * @param CompilationContext $compilationContext
+     * @param Variable $exprVariable
+     */
+    public function compileNativeArrayTraverse(CompilationContext $compilationContext, Variable $exprVariable)
+    {
+        $keyVariable = null;
+        $variable = null;
+
+        /**
+         * Initialize 'key' variable
+         */
+        if (isset($this->_statement['key'])) {
+            if ($this->_statement['key'] != '_') {
+                $keyVariable = $compilationContext->symbolTable->getVariableForWrite($this->_statement['key'], $compilationContext, $this->_statement['expr']);
+                switch ($keyVariable->getType()) {
+                    case 'int':
+                    case 'long':
+                    case 'variable':
+                        break;
+                    default:
+                        throw new CompilerException("Cannot use variable: " . $this->_statement['key'] . " type: " . $keyVariable->getType() . " as key in native array traversal", $this->_statement['expr']);
+                }
+            } else {
+                $keyVariable = $compilationContext->symbolTable->getTempVariableForWrite('long', $compilationContext);
+                $keyVariable->increaseUses();
+            }
+
+            $keyVariable->setMustInitNull(true);
+            $keyVariable->setIsInitialized(true, $compilationContext, $this->_statement);
+        }
+
+        /**
+         * Initialize 'value' variable
+         */
+        if (isset($this->_statement['value'])) {
+            $elementType = $exprVariable->getNativeArrayElementType();
+            if ($this->_statement['value'] != '_') {
+                $variable = $compilationContext->symbolTable->getVariableForWrite($this->_statement['value'], $compilationContext, $this->_statement['expr']);
+                $valueType = $variable->getType() == 'int' ? 'long' : $variable->getType();
+                if ($valueType != $elementType && $valueType != 'variable') {
+                    throw new CompilerException("Cannot use variable: " . $this->_statement['value'] . " type: " . $variable->getType() . " as value in " . $exprVariable->getType() . " traversal", $this->_statement['expr']);
+                }
+            } else {
+                $variable = $compilationContext->symbolTable->getTempVariableForWrite($elementType, $compilationContext);
+                $variable->increaseUses();
+            }
+
+            $variable->setMustInitNull(true);
+            $variable->setIsInitialized(true, $compilationContext, $this->_statement);
+            if ($variable->getType() == 'variable') {
+                $variable->setDynamicTypes($elementType);
+            }
+        }
+
+        $compilationContext->headersManager->add('kernel/array');
+
+        $compilationContext->backend->onLoopEnter($this->_statement, $compilationContext);
+
+        /**
+         * Variables are initialized in a different way inside cycle
+         */
+        $compilationContext->insideCycle++;
+
+        $st = null;
+        if (isset($this->_statement['statements'])) {
+            $st = new StatementsBlock($this->_statement['statements']);
+        }
+
+        $compilationContext->backend->forNativeArray($exprVariable, $keyVariable, $variable, $this->_statement, $st, $compilationContext);
+
+        $compilationContext->insideCycle--;
+
+        $compilationContext->backend->onLoopExit($compilationContext);
     }
 
     /**
@@ -692,6 +785,8 @@ class ForStatement extends StatementAbstract
             $variable->setDynamicTypes('undefined');
         }
 
+        $compilationContext->backend->onLoopEnter($this->_statement, $compilationContext);
+
         /**
          * Variables are initialized in a different way inside cycle
          */
@@ -748,6 +843,8 @@ class ForStatement extends StatementAbstract
          * Restore the cycle counter
          */
         $compilationContext->insideCycle--;
+
+        $compilationContext->backend->onLoopExit($compilationContext);
     }
 
     /**
@@ -804,6 +901,12 @@ class ForStatement extends StatementAbstract
                 $this->compileStringTraverse($expression, $compilationContext, $exprVariable);
                 break;
 
+            case 'int[]':
+            case 'double[]':
+            case 'bool[]':
+                $this->compileNativeArrayTraverse($compilationContext, $exprVariable);
+                break;
+
             default:
                 throw new CompilerException("Cannot traverse value type: " . $exprVariable->getType(), $exprRaw);
         }
@@ -206,6 +206,32 @@ class ArrayIndex
         }
     }
 
+    /**
+     * Compiles native[y] = {expr}, the value is stored in the buffer without creating a zval
+     *
+     * @param ZephirVariable $symbolVariable
+     * @param CompiledExpression $resolvedExpr
+     * @param CompilationContext $compilationContext
+     * @param array $statement
+     * @throws CompilerException
+     */
+    protected function _assignNativeArrayIndex(ZephirVariable $symbolVariable, CompiledExpression $resolvedExpr, CompilationContext $compilationContext, $statement)
+    {
+        if (count($statement['index-expr']) != 1) {
+            throw new CompilerException("Native arrays only have one dimension", $statement);
+        }
+
+        $expression = new Expression($statement['index-expr'][0]);
+        $exprIndex = $expression->compile($compilationContext);
+
+        $backend = $compilationContext->backend;
+        $index = $backend->getNativeArrayIndex($exprIndex, $compilationContext, $statement['index-expr'][0]);
+        $value = $backend->getNativeArrayValue($symbolVariable, $resolvedExpr, $compilationContext, $statement);
+
+        $compilationContext->headersManager->add('kernel/array');
+        $compilationContext->codePrinter->output('zephir_native_' . $symbolVariable->getNativeArrayElementType() . '_set(' . $backend->getVariableCode($symbolVariable) . ', ' . $index . ', ' . $value . ');');
+    }
+
     /**
      * Compiles foo[y][x] = {expr} (multiple offset)
      *
@@ -286,6 +312,11 @@ class ArrayIndex
             throw new CompilerException("Cannot mutate variable '" . $variable . "' because it is local only", $statement);
         }
 
+        if ($symbolVariable->isNativeArray()) {
+            $this->_assignNativeArrayIndex($symbolVariable, $resolvedExpr, $compilationContext, $statement);
+            return;
+        }
+
         /**
          * Only dynamic variables can be used as arrays
          */
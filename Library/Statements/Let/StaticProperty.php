@@ -101,7 +101,7 @@ class StaticProperty
 
         switch ($resolvedExpr->getType()) {
             case 'null':
-                $compilationContext->backend->updateStaticProperty($classEntry, $property, 'null', $compilationContext);
+                $compilationContext->backend->updateStaticProperty($classEntry, $property, 'null', $compilationContext, $classDefinition);
                 break;
 
             case 'int':
@@ -109,7 +109,7 @@ class StaticProperty
             case 'long':
                 $tempVariable = $compilationContext->symbolTable->getTempNonTrackedVariable('variable', $compilationContext, true);
                 $compilationContext->backend->assignLong($tempVariable, $resolvedExpr->getBooleanCode(), $compilationContext);
-                $compilationContext->backend->updateStaticProperty($classEntry, $property, $tempVariable, $compilationContext);
+                $compilationContext->backend->updateStaticProperty($classEntry, $property, $tempVariable, $compilationContext, $classDefinition);
                 if ($tempVariable->isTemporal()) {
                     $tempVariable->setIdle(true);
                 }
@@ -119,7 +119,7 @@ class StaticProperty
             case 'uchar':
                 $tempVariable = $compilationContext->symbolTable->getTempNonTrackedVariable('variable', $compilationContext, true);
                 $compilationContext->backend->assignLong($tempVariable, '\'' . $resolvedExpr->getCode() . '\'', $compilationContext);
-                $compilationContext->backend->updateStaticProperty($classEntry, $property, $tempVariable, $compilationContext);
+                $compilationContext->backend->updateStaticProperty($classEntry, $property, $tempVariable, $compilationContext, $classDefinition);
                 if ($tempVariable->isTemporal()) {
                     $tempVariable->setIdle(true);
                 }
@@ -128,7 +128,7 @@ class StaticProperty
             case 'double':
                 $tempVariable = $compilationContext->symbolTable->getTempNonTrackedVariable('variable', $compilationContext, true);
                 $compilationContext->backend->assignDouble($tempVariable, $resolvedExpr->getCode(), $compilationContext);
-                $compilationContext->backend->updateStaticProperty($classEntry, $property, $tempVariable, $compilationContext);
+                $compilationContext->backend->updateStaticProperty($classEntry, $property, $tempVariable, $compilationContext, $classDefinition);
                 if ($tempVariable->isTemporal()) {
                     $tempVariable->setIdle(true);
                 }
@@ -159,18 +159,18 @@ class StaticProperty
 
             case 'bool':
                 if ($resolvedExpr->getBooleanCode() == '1') {
-                    $compilationContext->backend->updateStaticProperty($classEntry, $property, 'true', $compilationContext);
+                    $compilationContext->backend->updateStaticProperty($classEntry, $property, 'true', $compilationContext, $classDefinition);
                 } else {
                     if ($resolvedExpr->getBooleanCode() == '0') {
-                        $compilationContext->backend->updateStaticProperty($classEntry, $property, 'false', $compilationContext);
+                        $compilationContext->backend->updateStaticProperty($classEntry, $property, 'false', $compilationContext, $classDefinition);
                     } else {
                         $codePrinter->output('if (' . $resolvedExpr->getBooleanCode() . ') {');
                         $codePrinter->increaseLevel();
-                        $compilationContext->backend->updateStaticProperty($classEntry, $property, 'true', $compilationContext);
+                        $compilationContext->backend->updateStaticProperty($classEntry, $property, 'true', $compilationContext, $classDefinition);
                         $codePrinter->decreaseLevel();
                         $codePrinter->output('} else {');
                         $codePrinter->increaseLevel();
-                        $compilationContext->backend->updateStaticProperty($classEntry, $property, 'false', $compilationContext);
+                        $compilationContext->backend->updateStaticProperty($classEntry, $property, 'false', $compilationContext, $classDefinition);
                         $codePrinter->decreaseLevel();
                         $codePrinter->output('}');
                     }
@@ -180,14 +180,14 @@ class StaticProperty
             case 'empty-array':
                 $tempVariable = $compilationContext->symbolTable->getTempNonTrackedVariable('variable', $compilationContext, true);
                 $compilationContext->backend->initArray($tempVariable, $compilationContext);
-                $compilationContext->backend->updateStaticProperty($classEntry, $property, $tempVariable, $compilationContext);
+                $compilationContext->backend->updateStaticProperty($classEntry, $property, $tempVariable, $compilationContext, $classDefinition);
                 if ($tempVariable->isTemporal()) {
                     $tempVariable->setIdle(true);
                 }
                 break;
 
             case 'array':
-                $compilationContext->backend->updateStaticProperty($classEntry, $property, $resolvedExpr, $compilationContext);
+                $compilationContext->backend->updateStaticProperty($classEntry, $property, $resolvedExpr, $compilationContext, $classDefinition);
                 break;
 
             case 'variable':
@@ -207,7 +207,7 @@ class StaticProperty
                             $propertyCache->setReusable(false);
                             $codePrinter->output('zephir_update_static_property_ce_cache(' . $classEntry .', SL("' . $property . '"), &' . $tempVariable->getName() . ', &' . $propertyCache->getName() . ' TSRMLS_CC);');
                         } else {
-                             $compilationContext->backend->updateStaticProperty($classEntry, $property, $tempVariable, $compilationContext);
+                             $compilationContext->backend->updateStaticProperty($classEntry, $property, $tempVariable, $compilationContext, $classDefinition);
                         }
                         if ($tempVariable->isTemporal()) {
                             $tempVariable->setIdle(true);
@@ -223,7 +223,7 @@ class StaticProperty
                             $propertyCache->setReusable(false);
                             $codePrinter->output('zephir_update_static_property_ce_cache(' . $classEntry .', SL("' . $property . '"), &' . $tempVariable->getName() . ', &' . $propertyCache->getName() . ' TSRMLS_CC);');
                         } else {
-                            $compilationContext->backend->updateStaticProperty($classEntry, $property, $tempVariable, $compilationContext);
+                            $compilationContext->backend->updateStaticProperty($classEntry, $property, $tempVariable, $compilationContext, $classDefinition);
                         }
                         if ($tempVariable->isTemporal()) {
                             $tempVariable->setIdle(true);
@@ -233,7 +233,7 @@ class StaticProperty
                     case 'bool':
                         $tempVariable = $compilationContext->symbolTable->getTempNonTrackedVariable('variable', $compilationContext, true);
                         $compilationContext->backend->assignBool($tempVariable, $variableVariable, $compilationContext);
-                        $compilationContext->backend->updateStaticProperty($classEntry, $property, $tempVariable, $compilationContext);
+                        $compilationContext->backend->updateStaticProperty($classEntry, $property, $tempVariable, $compilationContext, $classDefinition);
                         if ($tempVariable->isTemporal()) {
                             $tempVariable->setIdle(true);
                         }
@@ -260,7 +260,7 @@ class StaticProperty
                                 //continue
 
                             case 'assign':
-                                $compilationContext->backend->updateStaticProperty($classEntry, $property, $variableVariable, $compilationContext);
+                                $compilationContext->backend->updateStaticProperty($classEntry, $property, $variableVariable, $compilationContext, $classDefinition);
                                 if ($variableVariable->isTemporal()) {
                                     $variableVariable->setIdle(true);
                                 }
@@ -271,7 +271,7 @@ class StaticProperty
                         break;
                     case 'variable':
                     case 'array':
-                        $compilationContext->backend->updateStaticProperty($classEntry, $property, $variableVariable, $compilationContext);
+                        $compilationContext->backend->updateStaticProperty($classEntry, $property, $variableVariable, $compilationContext, $classDefinition);
                         if ($variableVariable->isTemporal()) {
                             $variableVariable->setIdle(true);
                         }
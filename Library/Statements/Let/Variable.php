@@ -441,7 +441,7 @@ class Variable
                         $compilationContext->backend->assignString($symbolVariable, $resolvedExpr->getCode(), $compilationContext);
                         break;
                     case 'concat-assign':
-                        $codePrinter->output('zephir_concat_self_str(&' . $variable . ', "' . $resolvedExpr->getCode() . '", sizeof("' . $resolvedExpr->getCode() . '")-1 TSRMLS_CC);');
+                        $codePrinter->output($compilationContext->backend->getConcatSelfFunction('_str', $compilationContext, $symbolVariable) . '(&' . $variable . ', "' . $resolvedExpr->getCode() . '", sizeof("' . $resolvedExpr->getCode() . '")-1 TSRMLS_CC);');
                         break;
                     default:
                         throw new CompilerException("Operator '" . $statement['operator'] . "' is not supported for variable type: string", $statement);
@@ -459,7 +459,7 @@ class Variable
                         }
                         break;
                     case 'concat-assign':
-                        $codePrinter->output('zephir_concat_self_str(&' . $variable . ', "' . $resolvedExpr->getCode() . '", sizeof("' . $resolvedExpr->getCode() . '")-1 TSRMLS_CC);');
+                        $codePrinter->output($compilationContext->backend->getConcatSelfFunction('_str', $compilationContext, $symbolVariable) . '(&' . $variable . ', "' . $resolvedExpr->getCode() . '", sizeof("' . $resolvedExpr->getCode() . '")-1 TSRMLS_CC);');
                         break;
                     default:
                         throw new CompilerException("Operator '" . $statement['operator'] . "' is not supported for variable type: string", $statement);
@@ -480,7 +480,7 @@ class Variable
 
                     case 'concat-assign':
                         $compilationContext->headersManager->add('kernel/operators');
-                        $codePrinter->output('zephir_concat_self_str(&' . $variable . ', "' . $resolvedExpr->getCode() . '", sizeof("' . $resolvedExpr->getCode() . '")-1 TSRMLS_CC);');
+                        $codePrinter->output($compilationContext->backend->getConcatSelfFunction('_str', $compilationContext, $symbolVariable) . '(&' . $variable . ', "' . $resolvedExpr->getCode() . '", sizeof("' . $resolvedExpr->getCode() . '")-1 TSRMLS_CC);');
                         break;
 
                     default:
@@ -505,7 +505,7 @@ class Variable
 
                             case 'concat-assign':
                                 $compilationContext->headersManager->add('kernel/operators');
-                                $codePrinter->output('zephir_concat_self_long(&' . $variable . ', ' . $itemVariable->getName() . ' TSRMLS_CC);');
+                                $codePrinter->output($compilationContext->backend->getConcatSelfFunction('_long', $compilationContext, $symbolVariable) . '(&' . $variable . ', ' . $itemVariable->getName() . ' TSRMLS_CC);');
                                 break;
 
                             default:
@@ -525,7 +525,7 @@ class Variable
 
                             case 'concat-assign':
                                 $compilationContext->headersManager->add('kernel/operators');
-                                $codePrinter->output('zephir_concat_self_char(&' . $variable . ', ' . $itemVariable->getName() . ' TSRMLS_CC);');
+                                $codePrinter->output($compilationContext->backend->getConcatSelfFunction('_char', $compilationContext, $symbolVariable) . '(&' . $variable . ', ' . $itemVariable->getName() . ' TSRMLS_CC);');
                                 break;
 
                             default:
@@ -894,7 +894,7 @@ class Variable
 
                     case 'concat-assign':
                         $compilationContext->headersManager->add('kernel/operators');
-                        $codePrinter->output('zephir_concat_self_str(&' . $variable . ', SL("' . $resolvedExpr->getCode() . '") TSRMLS_CC);');
+                        $codePrinter->output($compilationContext->backend->getConcatSelfFunction('_str', $compilationContext, $symbolVariable) . '(&' . $variable . ', SL("' . $resolvedExpr->getCode() . '") TSRMLS_CC);');
                         break;
 
                     default:
@@ -1077,6 +1077,21 @@ class Variable
                         }
                         break;
 
+                    case 'int[]':
+                    case 'double[]':
+                    case 'bool[]':
+                        switch ($statement['operator']) {
+                            case 'assign':
+                                $symbolVariable->initVariant($compilationContext);
+                                $symbolVariable->setDynamicTypes('array');
+                                $compilationContext->headersManager->add('kernel/array');
+                                $codePrinter->output('zephir_native_array_to_zval(' . $compilationContext->backend->getVariableCode($symbolVariable) . ', ' . $compilationContext->backend->getVariableCode($itemVariable) . ', ' . $itemVariable->getNativeArrayZendType() . ');');
+                                break;
+                            default:
+                                throw new CompilerException("Operator '" . $statement['operator'] . "' is not supported for variable type: " . $itemVariable->getType(), $statement);
+                        }
+                        break;
+
                     default:
                         throw new CompilerException("Unknown type: " . $itemVariable->getType(), $resolvedExpr->getOriginal());
                 }
@@ -1087,6 +1102,58 @@ class Variable
         }
     }
 
+    /**
+     * Compiles native = {expr}, PHP arrays are converted element by element
+     */
+    private function doNativeArrayAssignment($codePrinter, $resolvedExpr, $symbolVariable, $variable, $statement, $compilationContext)
+    {
+        if ($statement['operator'] != 'assign') {
+            throw new CompilerException("Operator '" . $statement['operator'] . "' is not supported for variable type: " . $symbolVariable->getType(), $statement);
+        }
+
+        switch ($resolvedExpr->getType()) {
+            case 'null':
+                $symbolVariable->initVariant($compilationContext);
+                break;
+
+            case 'variable':
+            case 'array':
+                $itemVariable = $compilationContext->symbolTable->getVariableForRead($resolvedExpr->getCode(), $compilationContext, $statement);
+                if ($itemVariable->getName() == $variable) {
+                    break;
+                }
+
+                $symbol = $compilationContext->backend->getVariableCode($symbolVariable);
+                if ($itemVariable->isNativeArray()) {
+                    if ($itemVariable->getType() != $symbolVariable->getType()) {
+                        throw new CompilerException("Cannot assign " . $itemVariable->getType() . " to " . $symbolVariable->getType(), $statement);
+                    }
+
+                    /* The buffer is shared until one of both is written */
+                    $symbolVariable->setMustInitNull(true);
+                    $compilationContext->symbolTable->mustGrownStack(true);
+                    $symbolVariable->increaseVariantIfNull();
+                    $codePrinter->output('ZEPHIR_CPY_WRT(' . $symbol . ', ' . $compilationContext->backend->getVariableCode($itemVariable) . ');');
+                    break;
+                }
+
+                if ($itemVariable->getType() != 'variable' && $itemVariable->getType() != 'array') {
+                    throw new CompilerException("Cannot assign " . $itemVariable->getType() . " to " . $symbolVariable->getType(), $statement);
+                }
+
+                $symbolVariable->initVariant($compilationContext);
+                $compilationContext->headersManager->add('kernel/array');
+                $codePrinter->output('zephir_native_array_from_zval(' . $symbol . ', ' . $compilationContext->backend->getVariableCode($itemVariable) . ', ' . $symbolVariable->getNativeArrayZendType() . ');');
+                if ($itemVariable->isTemporal()) {
+                    $itemVariable->setIdle(true);
+                }
+                break;
+
+            default:
+                throw new CompilerException("Cannot assign " . $resolvedExpr->getType() . " to " . $symbolVariable->getType(), $resolvedExpr->getOriginal());
+        }
+    }
+
     /**
      * Compiles foo = {expr}
      * Changes the value of a mutable variable
@@ -1155,6 +1222,12 @@ class Variable
                 $this->doVariableAssignment($codePrinter, $resolvedExpr, $symbolVariable, $variable, $statement, $compilationContext, $readDetector);
                 break;
 
+            case 'int[]':
+            case 'double[]':
+            case 'bool[]':
+                $this->doNativeArrayAssignment($codePrinter, $resolvedExpr, $symbolVariable, $variable, $statement, $compilationContext);
+                break;
+
             default:
                 throw new CompilerException("Unknown type: " . $type, $statement);
         }
@@ -60,6 +60,18 @@ class VariableAppend
             throw new CompilerException("Cannot mutate variable '" . $variable . "' because it is local only", $statement);
         }
 
+        /**
+         * Native arrays append the value to their buffer
+         */
+        if ($symbolVariable->isNativeArray()) {
+            $backend = $compilationContext->backend;
+            $value = $backend->getNativeArrayValue($symbolVariable, $resolvedExpr, $compilationContext, $statement);
+
+            $compilationContext->headersManager->add('kernel/array');
+            $compilationContext->codePrinter->output('zephir_native_' . $symbolVariable->getNativeArrayElementType() . '_append(' . $backend->getVariableCode($symbolVariable) . ', ' . $value . ');');
+            return;
+        }
+
         /**
          * Only dynamic variables and arrays can be used as arrays
          */
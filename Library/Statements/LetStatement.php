@@ -102,6 +102,14 @@ class LetStatement extends StatementAbstract
 
                 switch ($assignment['assign-type']) {
                     case 'variable':
+                        /**
+                         * Native arrays are converted from the value once it's computed
+                         */
+                        if ($symbolVariable->isNativeArray()) {
+                            $expr->setExpectReturn(true);
+                            break;
+                        }
+
                         if (!$readDetector->detect($variable, $assignment['expr'])) {
                             if (isset($assignment['operator'])) {
                                 if ($assignment['operator'] == 'assign') {
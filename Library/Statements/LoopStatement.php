@@ -40,6 +40,8 @@ class LoopStatement extends StatementAbstract
     {
         $compilationContext->codePrinter->output('while (1) {');
 
+        $compilationContext->backend->onLoopEnter($this->_statement, $compilationContext);
+
         /**
          * Variables are initialized in a different way inside cycle
          */
@@ -69,5 +71,7 @@ class LoopStatement extends StatementAbstract
         $compilationContext->insideCycle--;
 
         $compilationContext->codePrinter->output('}');
+
+        $compilationContext->backend->onLoopExit($compilationContext);
     }
 }
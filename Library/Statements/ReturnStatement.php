@@ -203,6 +203,13 @@ class ReturnStatement extends StatementAbstract
                         $symbolVariable = $compilationContext->symbolTable->getVariableForRead($resolvedExpr->getCode(), $compilationContext, $statement['expr']);
                     }
 
+                    /**
+                     * Strings grown inside the loop being left give back their spare capacity
+                     */
+                    if ($compilationContext->insideCycle) {
+                        $compilationContext->backend->trimGrownString($symbolVariable, $compilationContext);
+                    }
+
                     switch ($symbolVariable->getType()) {
                         case 'int':
                         case 'uint':
@@ -253,6 +260,14 @@ class ReturnStatement extends StatementAbstract
                             }
                             break;
 
+                        case 'int[]':
+                        case 'double[]':
+                        case 'bool[]':
+                            $compilationContext->headersManager->add('kernel/array');
+                            $codePrinter->output('zephir_native_array_to_zval(return_value, ' . $compilationContext->backend->getVariableCode($symbolVariable) . ', ' . $symbolVariable->getNativeArrayZendType() . ');');
+                            $codePrinter->output('RETURN_MM();');
+                            break;
+
                         default:
                             throw new CompilerException("Cannot return variable '" . $symbolVariable->getType() . "'", $statement['expr']);
                     }
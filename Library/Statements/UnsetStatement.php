@@ -45,6 +45,10 @@ class UnsetStatement extends StatementAbstract
 
         switch ($expression['type']) {
             case 'array-access':
+                if ($this->compilePropertyArrayUnset($expression, $compilationContext)) {
+                    return true;
+                }
+
                 $expr = new Expression($expression['left']);
                 $expr->setReadOnly(true);
                 $exprVar = $expr->compile($compilationContext);
@@ -83,4 +87,51 @@ class UnsetStatement extends StatementAbstract
 
         $compilationContext->backend->arrayUnset($variable, $exprIndex, $flags, $compilationContext);
     }
+
+    /**
+     * Unsets an index of an array property in the property itself (ZE3), the property is
+     * not read and written back. Only indexes held in dynamic variables are handled here
+     *
+     * @param array $expression
+     * @param CompilationContext $compilationContext
+     * @return boolean
+     */
+    protected function compilePropertyArrayUnset(array $expression, CompilationContext $compilationContext)
+    {
+        if ($compilationContext->backend->getName() != 'ZendEngine3' || $expression['left']['type'] != 'property-access') {
+            return false;
+        }
+
+        if ($expression['right']['type'] != 'variable' || $expression['left']['left']['type'] != 'variable') {
+            return false;
+        }
+
+        $expr = new Expression($expression['right']);
+        $expr->setReadOnly(true);
+        $exprIndex = $expr->compile($compilationContext);
+        if ($exprIndex->getType() != 'variable') {
+            return false;
+        }
+
+        $variableIndex = $compilationContext->symbolTable->getVariableForRead($exprIndex->getCode(), $compilationContext, $expression['right']);
+        if ($variableIndex->getType() != 'variable') {
+            return false;
+        }
+
+        $expr = new Expression($expression['left']['left']);
+        $expr->setReadOnly(true);
+        $exprVar = $expr->compile($compilationContext);
+        if ($exprVar->getType() != 'variable') {
+            return false;
+        }
+
+        $variable = $compilationContext->symbolTable->getVariableForRead($exprVar->getCode(), $compilationContext, $expression['left']['left']);
+        if ($variable->getType() != 'variable') {
+            return false;
+        }
+
+        $compilationContext->headersManager->add('kernel/object');
+        $compilationContext->codePrinter->output('zephir_unset_property_array(' . $compilationContext->backend->getVariableCode($variable) . ', SL("' . $expression['left']['right']['value'] . '"), ' . $compilationContext->backend->getVariableCode($variableIndex) . ');');
+        return true;
+    }
 }
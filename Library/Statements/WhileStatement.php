@@ -46,6 +46,8 @@ class WhileStatement extends StatementAbstract
 
         $codePrinter->increaseLevel();
 
+        $compilationContext->backend->onLoopEnter($this->_statement, $compilationContext);
+
         /**
          * Variables are initialized in a different way inside loops
          */
@@ -76,5 +78,7 @@ class WhileStatement extends StatementAbstract
         $compilationContext->insideCycle--;
 
         $codePrinter->output('}');
+
+        $compilationContext->backend->onLoopExit($compilationContext);
     }
 }
@@ -20,6 +20,7 @@
 namespace Zephir;
 
 use Zephir\Detectors\ReadDetector;
+use Zephir\Cache\SlotsCache;
 
 /**
  * StaticCall
@@ -48,8 +49,13 @@ class StaticCall extends Call
         }
 
         /* Do not optimize static:: calls, to allow late static binding */
-        if ($context == 'SELF') {
-            $method = $method->getOptimizedMethod();
+        if ($context == 'SELF' && isset($method) && ($method->isStatic() || $method->isInternal())) {
+            $optimizedMethod = $method->getOptimizedMethod();
+            if ($optimizedMethod->isInternal()) {
+                if ($this->canCallInternal($optimizedMethod, isset($expression['parameters']) ? $expression['parameters'] : array(), $compilationContext, $expression)) {
+                    $method = $optimizedMethod;
+                }
+            }
         }
 
         $codePrinter = $compilationContext->codePrinter;
@@ -70,17 +76,22 @@ class StaticCall extends Call
         $methodCache = $compilationContext->cacheManager->getStaticMethodCache();
         $cachePointer = $methodCache->get($compilationContext, isset($method) ? $method : null, false);
 
-        if (isset($expression['parameters']) && count($expression['parameters'])) {
-            $params = $this->getResolvedParams($expression['parameters'], $compilationContext, $expression);
-        } else {
-            $params = array();
-        }
-
         $isInternal = false;
         if (isset($method)) {
             $isInternal = $method->isInternal();
         }
 
+        if ($isInternal) {
+            if (!$this->canCallInternal($method, isset($expression['parameters']) ? $expression['parameters'] : array(), $compilationContext, $expression)) {
+                throw new CompilerException("Invalid parameters passed to internal method: '" . $methodName . "'", $expression);
+            }
+            $params = $this->getResolvedParams(isset($expression['parameters']) ? $expression['parameters'] : array(), $compilationContext, $expression, $method);
+        } else if (isset($expression['parameters']) && count($expression['parameters'])) {
+            $params = $this->getResolvedParams($expression['parameters'], $compilationContext, $expression);
+        } else {
+            $params = array();
+        }
+
         if ($symbolVariable) {
             $symbol = $compilationContext->backend->getVariableCodePointer($symbolVariable);
         }
@@ -99,16 +110,17 @@ class StaticCall extends Call
             }
         } else {
             $ce = $method->getClassDefinition()->getClassEntry($compilationContext);
+            $typedParams = $this->getTypedParameters();
             if ($isExpecting) {
                 if ($symbolVariable->getName() == 'return_value') {
-                    $macro = $compilationContext->backend->getFcallManager()->getMacro(true, true, $paramCount);
+                    $macro = $compilationContext->backend->getFcallManager()->getMacro(true, true, $paramCount, $typedParams);
                     $codePrinter->output($macro . '(' . $ce . ', ' . $method->getInternalName() . $paramsStr . ');');
                 } else {
-                    $macro = $compilationContext->backend->getFcallManager()->getMacro(true, 2, $paramCount);
+                    $macro = $compilationContext->backend->getFcallManager()->getMacro(true, 2, $paramCount, $typedParams);
                     $codePrinter->output($macro . '(' . $symbol . ', ' . $ce . ', ' . $method->getInternalName() . $paramsStr . ');');
                 }
             } else {
-                $macro = $compilationContext->backend->getFcallManager()->getMacro(true, false, $paramCount);
+                $macro = $compilationContext->backend->getFcallManager()->getMacro(true, false, $paramCount, $typedParams);
                 $codePrinter->output($macro . '(' . $ce . ', ' . $method->getInternalName() . $paramsStr . ');');
             }
         }
@@ -234,8 +246,13 @@ class StaticCall extends Call
             $symbolVariable->trackVariant($compilationContext);
         }
 
-        if ($method) {
-            $method = $method->getOptimizedMethod();
+        if ($method && ($method->isStatic() || $method->isInternal())) {
+            $optimizedMethod = $method->getOptimizedMethod();
+            if ($optimizedMethod->isInternal()) {
+                if ($this->canCallInternal($optimizedMethod, isset($expression['parameters']) ? $expression['parameters'] : array(), $compilationContext, $expression)) {
+                    $method = $optimizedMethod;
+                }
+            }
         }
 
         /**
@@ -244,7 +261,12 @@ class StaticCall extends Call
         $methodCache = $compilationContext->cacheManager->getStaticMethodCache();
         $cachePointer = $methodCache->get($compilationContext, isset($method) ? $method : null);
 
-        if (isset($expression['parameters']) && count($expression['parameters'])) {
+        if ($method && $method->isInternal()) {
+            if (!$this->canCallInternal($method, isset($expression['parameters']) ? $expression['parameters'] : array(), $compilationContext, $expression)) {
+                throw new CompilerException("Invalid parameters passed to internal method: '" . $methodName . "'", $expression);
+            }
+            $params = $this->getResolvedParams(isset($expression['parameters']) ? $expression['parameters'] : array(), $compilationContext, $expression, $method);
+        } else if (isset($expression['parameters']) && count($expression['parameters'])) {
             $params = $this->getResolvedParams($expression['parameters'], $compilationContext, $expression);
         } else {
             $params = array();
@@ -257,18 +279,19 @@ class StaticCall extends Call
         $paramCount = count($params);
         $paramsStr = $paramCount ? ', ' . join(', ', $params) : '';
 
-        if ($method->isInternal()) {
+        if ($method && $method->isInternal()) {
             $ce = $classDefinition->getClassEntry($compilationContext);
+            $typedParams = $this->getTypedParameters();
             if ($isExpecting) {
                 if ($symbolVariable->getName() == 'return_value') {
-                    $macro = $compilationContext->backend->getFcallManager()->getMacro(true, true, $paramCount);
+                    $macro = $compilationContext->backend->getFcallManager()->getMacro(true, true, $paramCount, $typedParams);
                     $codePrinter->output($macro . '(' . $ce . ', ' . $method->getInternalName() . $paramsStr . ');');
                 } else {
-                    $macro = $compilationContext->backend->getFcallManager()->getMacro(true, 2, $paramCount);
+                    $macro = $compilationContext->backend->getFcallManager()->getMacro(true, 2, $paramCount, $typedParams);
                     $codePrinter->output($macro . '(' . $symbol . ', ' . $ce . ', ' . $method->getInternalName() . $paramsStr . ');');
                 }
             } else {
-                $macro = $compilationContext->backend->getFcallManager()->getMacro(true, false, $paramCount);
+                $macro = $compilationContext->backend->getFcallManager()->getMacro(true, false, $paramCount, $typedParams);
                 $codePrinter->output($macro . '(' . $ce . ', ' . $method->getInternalName() . $paramsStr . ');');
             }
         } else {
@@ -336,7 +359,11 @@ class StaticCall extends Call
         $compilationContext->headersManager->add('kernel/object');
 
         $classEntryVariable = $compilationContext->symbolTable->addTemp('zend_class_entry', $compilationContext);
-        $codePrinter->output($classEntryVariable->getName() . ' = zephir_fetch_class(' . $compilationContext->backend->getVariableCode($classNameVariable) . ' TSRMLS_CC);');
+        if ($compilationContext->backend->isZE3()) {
+            $codePrinter->output($classEntryVariable->getName() . ' = zephir_fetch_class_cached(' . $compilationContext->backend->getVariableCode($classNameVariable) . ', ' . SlotsCache::getClassEntrySlot() . ');');
+        } else {
+            $codePrinter->output($classEntryVariable->getName() . ' = zephir_fetch_class(' . $compilationContext->backend->getVariableCode($classNameVariable) . ' TSRMLS_CC);');
+        }
         $classEntry = $classEntryVariable->getName();
 
 
@@ -418,7 +445,11 @@ class StaticCall extends Call
         $compilationContext->headersManager->add('kernel/object');
 
         $classEntryVariable = $compilationContext->symbolTable->addTemp('zend_class_entry', $compilationContext);
-        $codePrinter->output($classEntryVariable->getName() . ' = zephir_fetch_class(' . $classNameVariable->getName() . ' TSRMLS_CC);');
+        if ($compilationContext->backend->isZE3()) {
+            $codePrinter->output($classEntryVariable->getName() . ' = zephir_fetch_class_cached(' . $compilationContext->backend->getVariableCode($classNameVariable) . ', ' . SlotsCache::getClassEntrySlot() . ');');
+        } else {
+            $codePrinter->output($classEntryVariable->getName() . ' = zephir_fetch_class(' . $classNameVariable->getName() . ' TSRMLS_CC);');
+        }
         $classEntry = $classEntryVariable->getName();
 
         /**
@@ -36,6 +36,19 @@ abstract class StringsManager
         'sv' => true
     );
 
+    /**
+     * Constant names and string literals interned when the extension is loaded
+     * @var array
+     */
+    protected $internedStrings = array();
+
+    /**
+     * Prefix of the C symbols holding the interned strings, the extension name keeps them unique
+     * when several extensions are loaded together
+     * @var string
+     */
+    protected $symbolPrefix = 'zephir';
+
     /**
      * Adds a concatenation combination to the manager
      *
@@ -62,4 +75,26 @@ abstract class StringsManager
     {
         return $this->concatKeys;
     }
+
+    /**
+     * Sets the prefix of the C symbols holding the interned strings
+     *
+     * @param string $prefix
+     */
+    public function setSymbolPrefix($prefix)
+    {
+        $this->symbolPrefix = strtolower(preg_replace('/[^a-zA-Z0-9_]/', '_', $prefix));
+    }
+
+    /**
+     * Obtains the constant names and string literals interned when the extension is loaded
+     *
+     * @return array
+     */
+    public function getInternedStrings()
+    {
+        $internedStrings = array_keys($this->internedStrings);
+        sort($internedStrings, SORT_STRING);
+        return $internedStrings;
+    }
 }
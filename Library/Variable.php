@@ -37,6 +37,15 @@ class Variable
      */
     protected $dynamicTypes = array('unknown' => true);
 
+    /**
+     * Element types and zend types of the native typed arrays
+     */
+    protected static $nativeArrayTypes = array(
+        'int[]'    => array('long', 'IS_LONG'),
+        'double[]' => array('double', 'IS_DOUBLE'),
+        'bool[]'   => array('bool', '_IS_BOOL'),
+    );
+
     /**
      * Variable's name
      */
@@ -198,6 +207,36 @@ class Variable
         return $this->type;
     }
 
+    /**
+     * Checks whether the variable is a native typed array (int[], double[], bool[])
+     *
+     * @return boolean
+     */
+    public function isNativeArray()
+    {
+        return isset(self::$nativeArrayTypes[$this->type]);
+    }
+
+    /**
+     * Returns the type of the elements of a native typed array: long, double or bool
+     *
+     * @return string
+     */
+    public function getNativeArrayElementType()
+    {
+        return self::$nativeArrayTypes[$this->type][0];
+    }
+
+    /**
+     * Returns the zend type constant of the elements of a native typed array
+     *
+     * @return string
+     */
+    public function getNativeArrayZendType()
+    {
+        return self::$nativeArrayTypes[$this->type][1];
+    }
+
     /**
      * Sets if the variable is local-only scoped
      *
@@ -702,6 +741,9 @@ class Variable
             case 'variable':
             case 'string':
             case 'array':
+            case 'int[]':
+            case 'double[]':
+            case 'bool[]':
                 $this->defaultInitValue = null;
                 $this->setDynamicTypes('null');
                 $this->setMustInitNull(true);
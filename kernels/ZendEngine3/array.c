@@ -35,6 +35,10 @@
 #include "kernel/hash.h"
 #include "kernel/backtrace.h"
 
+#define ZEPHIR_IN_ARRAY_SLOT(haystack) (((zend_uintptr_t) (haystack) >> 3) % ZEPHIR_MAX_IN_ARRAY_SLOTS)
+
+static void zephir_in_array_cache_forget(zend_array *haystack);
+
 
 void ZEPHIR_FASTCALL zephir_create_array(zval *return_value, uint size, int initialize)
 {
@@ -124,6 +128,25 @@ int zephir_array_isset_string_fetch(zval *fetched, zval *arr, char *index, uint
 	return 0;
 }
 
+int zephir_array_isset_str_fetch(zval *fetched, zval *arr, zend_string *index, int readonly)
+{
+	zval *zv;
+
+	ZVAL_NULL(fetched);
+
+	if (likely(Z_TYPE_P(arr) == IS_ARRAY)) {
+		if ((zv = zend_hash_find(Z_ARRVAL_P(arr), index)) != NULL) {
+			if (!readonly) {
+				ZVAL_COPY(fetched, zv);
+			} else {
+				ZVAL_COPY_VALUE(fetched, zv);
+			}
+			return 1;
+		}
+	}
+	return 0;
+}
+
 int zephir_array_isset_long_fetch(zval *fetched, zval *arr, unsigned long index, int readonly)
 {
 	zval *zv;
@@ -131,7 +154,7 @@ int zephir_array_isset_long_fetch(zval *fetched, zval *arr, unsigned long index,
 	ZVAL_NULL(fetched);
 
 	if (likely(Z_TYPE_P(arr) == IS_ARRAY)) {
-		if ((zv = zend_hash_index_find(Z_ARRVAL_P(arr), index)) != NULL) {
+		if ((zv = zephir_hash_index_find(Z_ARRVAL_P(arr), index)) != NULL) {
 			if (!readonly) {
 				ZVAL_COPY(fetched, zv);
 			} else {
@@ -185,10 +208,19 @@ int ZEPHIR_FASTCALL zephir_array_isset_string(const zval *arr, const char *index
 	return 0;
 }
 
+int ZEPHIR_FASTCALL zephir_array_isset_str(const zval *arr, zend_string *index)
+{
+	if (likely(Z_TYPE_P(arr) == IS_ARRAY)) {
+		return zend_hash_exists(Z_ARRVAL_P(arr), index);
+	}
+
+	return 0;
+}
+
 int ZEPHIR_FASTCALL zephir_array_isset_long(const zval *arr, unsigned long index)
 {
 	if (likely(Z_TYPE_P(arr) == IS_ARRAY)) {
-		return zend_hash_index_exists(Z_ARRVAL_P(arr), index);
+		return zephir_hash_index_find(Z_ARRVAL_P(arr), index) != NULL;
 	}
 
 	return 0;
@@ -202,6 +234,7 @@ int ZEPHIR_FASTCALL zephir_array_unset(zval *arr, zval *index, int flags)
 		return FAILURE;
 	}
 
+	zephir_in_array_cache_forget(Z_ARRVAL_P(arr));
 	if ((flags & PH_SEPARATE) == PH_SEPARATE) {
 		SEPARATE_ZVAL_IF_NOT_REF(arr);
 	}
@@ -240,6 +273,7 @@ int ZEPHIR_FASTCALL zephir_array_unset_string(zval *arr, const char *index, uint
 		return 0;
 	}
 
+	zephir_in_array_cache_forget(Z_ARRVAL_P(arr));
 	if ((flags & PH_SEPARATE) == PH_SEPARATE) {
 		SEPARATE_ZVAL_IF_NOT_REF(arr);
 	}
@@ -253,6 +287,7 @@ int ZEPHIR_FASTCALL zephir_array_unset_long(zval *arr, unsigned long index, int
 		return 0;
 	}
 
+	zephir_in_array_cache_forget(Z_ARRVAL_P(arr));
 	if ((flags & PH_SEPARATE) == PH_SEPARATE) {
 		SEPARATE_ZVAL_IF_NOT_REF(arr);
 	}
@@ -267,11 +302,15 @@ int zephir_array_append(zval *arr, zval *value, int flags ZEPHIR_DEBUG_PARAMS)
 		return FAILURE;
 	}
 
+	zephir_in_array_cache_forget(Z_ARRVAL_P(arr));
 	if ((flags & PH_SEPARATE) == PH_SEPARATE) {
 		SEPARATE_ZVAL_IF_NOT_REF(arr);
 	}
 
 	Z_TRY_ADDREF_P(value);
+	if (zephir_hash_packed_update(Z_ARRVAL_P(arr), Z_ARRVAL_P(arr)->nNumUsed, value)) {
+		return SUCCESS;
+	}
 	return add_next_index_zval(arr, value);
 }
 
@@ -299,7 +338,7 @@ int zephir_array_fetch(zval *return_value, zval *arr, zval *index, int flags ZEP
 			case IS_LONG:
 			case IS_RESOURCE:
 				uidx   = Z_LVAL_P(index);
-				result = (zv = zend_hash_index_find(ht, uidx)) != NULL;
+				result = (zv = zephir_hash_index_find(ht, uidx)) != NULL;
 				break;
 
 			case IS_FALSE:
@@ -379,12 +418,44 @@ int zephir_array_fetch_string(zval *return_value, zval *arr, const char *index,
 	return FAILURE;
 }
 
+int zephir_array_fetch_str(zval *return_value, zval *arr, zend_string *index, int flags ZEPHIR_DEBUG_PARAMS)
+{
+	zval *zv;
+
+	if (likely(Z_TYPE_P(arr) == IS_ARRAY)) {
+		if ((zv = zend_hash_find(Z_ARRVAL_P(arr), index)) != NULL) {
+
+			if ((flags & PH_READONLY) == PH_READONLY) {
+				ZVAL_COPY_VALUE(return_value, zv);
+			} else {
+				ZVAL_COPY(return_value, zv);
+			}
+			return SUCCESS;
+		}
+		if ((flags & PH_NOISY) == PH_NOISY) {
+			zend_error(E_NOTICE, "Undefined index: %s", ZSTR_VAL(index));
+		}
+	} else {
+		if ((flags & PH_NOISY) == PH_NOISY) {
+			zend_error(E_NOTICE, "Cannot use a scalar value as an array in %s on line %d", file, line);
+		}
+	}
+
+	if (return_value == NULL) {
+		zend_error(E_ERROR, "No return value passed to zephir_array_fetch_str");
+		return FAILURE;
+	}
+
+	ZVAL_NULL(return_value);
+	return FAILURE;
+}
+
 int zephir_array_fetch_long(zval *return_value, zval *arr, unsigned long index, int flags ZEPHIR_DEBUG_PARAMS)
 {
 	zval *zv;
 
 	if (likely(Z_TYPE_P(arr) == IS_ARRAY)) {
-		if ((zv = zend_hash_index_find(Z_ARRVAL_P(arr), index)) != NULL) {
+		if ((zv = zephir_hash_index_find(Z_ARRVAL_P(arr), index)) != NULL) {
 
 			if ((flags & PH_READONLY) == PH_READONLY) {
 				ZVAL_COPY_VALUE(return_value, zv);
@@ -428,6 +499,7 @@ int zephir_array_update_zval(zval *arr, zval *index, zval *value, int flags)
 		value = &new_zv;
 	}
 
+	zephir_in_array_cache_forget(Z_ARRVAL_P(arr));
 	if ((flags & PH_SEPARATE) == PH_SEPARATE) {
 		SEPARATE_ZVAL_IF_NOT_REF(arr);
 	}
@@ -485,6 +557,7 @@ int zephir_array_update_string(zval *arr, const char *index, uint index_length,
 		value = &new_zv;
 	}
 
+	zephir_in_array_cache_forget(Z_ARRVAL_P(arr));
 	if ((flags & PH_SEPARATE) == PH_SEPARATE) {
 		SEPARATE_ZVAL_IF_NOT_REF(arr);
 	}
@@ -513,6 +586,7 @@ int zephir_array_update_long(zval *arr, unsigned long index, zval *value, int fl
 		value = &new_zv;
 	}
 
+	zephir_in_array_cache_forget(Z_ARRVAL_P(arr));
 	if ((flags & PH_SEPARATE) == PH_SEPARATE) {
 		SEPARATE_ZVAL_IF_NOT_REF(arr);
 	}
@@ -521,7 +595,9 @@ int zephir_array_update_long(zval *arr, unsigned long index, zval *value, int fl
 		Z_TRY_ADDREF_P(value);
 	}
 
-	zv = zend_hash_index_update(Z_ARRVAL_P(arr), index, value);
+	if ((zv = zephir_hash_packed_update(Z_ARRVAL_P(arr), index, value)) == NULL) {
+		zv = zend_hash_index_update(Z_ARRVAL_P(arr), index, value);
+	}
 	return zv != NULL ? SUCCESS : FAILURE;
 }
 
@@ -770,6 +846,9 @@ int zephir_array_update_multi(zval *arr, zval *value, const char *types, int typ
 {
 	va_list ap;
 	va_start(ap, types_count);
+	if (Z_TYPE_P(arr) == IS_ARRAY) {
+		zephir_in_array_cache_forget(Z_ARRVAL_P(arr));
+	}
 	SEPARATE_ZVAL_IF_NOT_REF(arr);
 
 	zephir_array_update_multi_ex(arr, value, types, types_length, types_count, ap);
@@ -778,6 +857,304 @@ int zephir_array_update_multi(zval *arr, zval *value, const char *types, int typ
 	return 0;
 }
 
+/**
+ * Makes the element reached by a nested update an array owned by its container
+ */
+static zval *zephir_array_nested_init(zval *zv)
+{
+	zval garbage;
+
+	ZVAL_DEREF(zv);
+	if (EXPECTED(Z_TYPE_P(zv) == IS_ARRAY)) {
+		SEPARATE_ARRAY(zv);
+	} else {
+		ZVAL_COPY_VALUE(&garbage, zv);
+		array_init(zv);
+		zval_ptr_dtor(&garbage);
+	}
+
+	return zv;
+}
+
+static zval *zephir_array_nested_symtable(HashTable *ht, const char *index, size_t index_length)
+{
+	zval tmp, *zv;
+
+	if ((zv = zend_symtable_str_find(ht, index, index_length)) != NULL) {
+		return zephir_array_nested_init(zv);
+	}
+
+	array_init(&tmp);
+	return zend_symtable_str_update(ht, index, index_length, &tmp);
+}
+
+/**
+ * Separates the array a nested update starts from, the levels below it are
+ * reached with zephir_array_nested_long/string/zval and updated in place
+ */
+zval *zephir_array_nested_root(zval *arr)
+{
+	ZVAL_DEREF(arr);
+	if (UNEXPECTED(Z_TYPE_P(arr) != IS_ARRAY)) {
+		zend_error(E_ERROR, "Cannot use a scalar value as an array (multi)");
+		return NULL;
+	}
+
+	SEPARATE_ARRAY(arr);
+	return arr;
+}
+
+/**
+ * Fetches arr[index] for write, creating or separating the array stored there
+ */
+zval *zephir_array_nested_long(zval *arr, zend_ulong index)
+{
+	zval tmp, *zv;
+
+	if (UNEXPECTED(arr == NULL)) {
+		return NULL;
+	}
+
+	if ((zv = zephir_hash_index_find(Z_ARRVAL_P(arr), index)) != NULL) {
+		return zephir_array_nested_init(zv);
+	}
+
+	array_init(&tmp);
+	return zend_hash_index_add_new(Z_ARRVAL_P(arr), index, &tmp);
+}
+
+zval *zephir_array_nested_string(zval *arr, const char *index, uint index_length)
+{
+	zval tmp, *zv;
+
+	if (UNEXPECTED(arr == NULL)) {
+		return NULL;
+	}
+
+	if ((zv = zend_hash_str_find(Z_ARRVAL_P(arr), index, index_length)) != NULL) {
+		return zephir_array_nested_init(zv);
+	}
+
+	array_init(&tmp);
+	return zend_hash_str_add_new(Z_ARRVAL_P(arr), index, index_length, &tmp);
+}
+
+zval *zephir_array_nested_zval(zval *arr, zval *index)
+{
+	if (UNEXPECTED(arr == NULL)) {
+		return NULL;
+	}
+
+	switch (Z_TYPE_P(index)) {
+		case IS_NULL:
+			return zephir_array_nested_symtable(Z_ARRVAL_P(arr), "", 1);
+
+		case IS_DOUBLE:
+			return zephir_array_nested_long(arr, (zend_ulong) Z_DVAL_P(index));
+
+		case IS_LONG:
+		case IS_RESOURCE:
+			return zephir_array_nested_long(arr, Z_LVAL_P(index));
+
+		case IS_TRUE:
+		case IS_FALSE:
+			return zephir_array_nested_long(arr, Z_TYPE_P(index) == IS_TRUE ? 1 : 0);
+
+		case IS_STRING:
+			return zephir_array_nested_symtable(Z_ARRVAL_P(arr), Z_STRVAL_P(index), Z_STRLEN_P(index));
+
+		default:
+			zend_error(E_WARNING, "Illegal offset type");
+			return NULL;
+	}
+}
+
+#define ZEPHIR_IN_ARRAY_INDEX_MIN_SIZE 16
+#define ZEPHIR_IN_ARRAY_INDEX_LOOKUPS 4
+
+static void zephir_in_array_cache_release(zephir_in_array_cache *entry)
+{
+	zval haystack;
+
+	if (entry->index) {
+		zend_hash_destroy(entry->index);
+		efree(entry->index);
+		if (!(GC_FLAGS(entry->haystack) & IS_ARRAY_IMMUTABLE)) {
+			ZVAL_ARR(&haystack, entry->haystack);
+			zval_ptr_dtor(&haystack);
+		}
+	}
+
+	memset(entry, 0, sizeof(zephir_in_array_cache));
+}
+
+void zephir_in_array_cache_destroy(void)
+{
+	zend_zephir_globals_def *zephir_globals_ptr = ZEPHIR_VGLOBAL;
+	int i;
+
+	for (i = 0; i < ZEPHIR_MAX_IN_ARRAY_SLOTS; i++) {
+		zephir_in_array_cache_release(&zephir_globals_ptr->iacache[i]);
+	}
+}
+
+/**
+ * Drops the index of an array the kernel is about to write, releasing the reference held by the
+ * cache before the write checks whether the array has to be separated
+ */
+static void zephir_in_array_cache_forget(zend_array *haystack)
+{
+	zephir_in_array_cache *entry = &ZEPHIR_VGLOBAL->iacache[ZEPHIR_IN_ARRAY_SLOT(haystack)];
+
+	if (UNEXPECTED(entry->haystack == haystack)) {
+		zephir_in_array_cache_release(entry);
+	}
+}
+
+/**
+ * Releases the indexed haystacks nothing but the cache references anymore
+ */
+static void zephir_in_array_cache_collect(zend_zephir_globals_def *zephir_globals_ptr)
+{
+	zephir_in_array_cache *entry;
+	int i;
+
+	for (i = 0; i < ZEPHIR_MAX_IN_ARRAY_SLOTS; i++) {
+		entry = &zephir_globals_ptr->iacache[i];
+		if (entry->index && !(GC_FLAGS(entry->haystack) & IS_ARRAY_IMMUTABLE) && GC_REFCOUNT(entry->haystack) == 1) {
+			zephir_in_array_cache_release(entry);
+		}
+	}
+}
+
+/**
+ * Builds the value index of a haystack, only arrays holding nothing but strings or nothing but
+ * integers are indexed since loose comparison of any other mix can't be answered by a hash lookup
+ */
+static void zephir_in_array_cache_build(zephir_in_array_cache *entry, zend_array *haystack)
+{
+	zval *value;
+	zend_uchar type = IS_UNDEF;
+
+	ZEND_HASH_FOREACH_VAL(haystack, value) {
+		if (type == IS_UNDEF && (Z_TYPE_P(value) == IS_STRING || Z_TYPE_P(value) == IS_LONG)) {
+			type = Z_TYPE_P(value);
+		}
+		if (Z_TYPE_P(value) != type) {
+			entry->type = IS_NULL;
+			return;
+		}
+	} ZEND_HASH_FOREACH_END();
+
+	ALLOC_HASHTABLE(entry->index);
+	zend_hash_init(entry->index, zend_hash_num_elements(haystack), NULL, NULL, 0);
+
+	ZEND_HASH_FOREACH_VAL(haystack, value) {
+		if (type == IS_STRING) {
+			zend_hash_add_empty_element(entry->index, Z_STR_P(value));
+		} else {
+			zend_hash_index_add_empty_element(entry->index, Z_LVAL_P(value));
+		}
+	} ZEND_HASH_FOREACH_END();
+
+	/* The reference keeps the address from being reused, kernel writes drop it before separating */
+	if (!(GC_FLAGS(haystack) & IS_ARRAY_IMMUTABLE)) {
+		GC_REFCOUNT(haystack)++;
+	}
+
+	entry->type = type;
+	entry->data = haystack->arData;
+	entry->used = haystack->nNumUsed;
+	entry->elements = haystack->nNumOfElements;
+	entry->next_free_element = haystack->nNextFreeElement;
+}
+
+/**
+ * Answers in_array from the haystack index, returns -1 when the haystack isn't indexed (yet)
+ */
+static int zephir_in_array_cache_lookup(zval *value, zend_array *haystack)
+{
+	zend_zephir_globals_def *zephir_globals_ptr = ZEPHIR_VGLOBAL;
+	zephir_in_array_cache *entry;
+
+	if (zend_hash_num_elements(haystack) < ZEPHIR_IN_ARRAY_INDEX_MIN_SIZE || !zephir_globals_ptr->cache_enabled) {
+		return -1;
+	}
+
+	/* Numeric strings compare numerically, they can only be found by scanning */
+	if (Z_TYPE_P(value) == IS_STRING) {
+		if (is_numeric_string(Z_STRVAL_P(value), Z_STRLEN_P(value), NULL, NULL, 0)) {
+			return -1;
+		}
+	} else if (Z_TYPE_P(value) != IS_LONG) {
+		return -1;
+	}
+
+	entry = &zephir_globals_ptr->iacache[ZEPHIR_IN_ARRAY_SLOT(haystack)];
+
+	if (entry->haystack != haystack) {
+		/* Indexed haystacks are evicted once other arrays have taken over the slot or nothing else uses them */
+		if (entry->index && GC_REFCOUNT(entry->haystack) > 1 && --entry->lookups > 0) {
+			return -1;
+		}
+		zephir_in_array_cache_release(entry);
+		entry->haystack = haystack;
+	}
+
+	if (!entry->index) {
+		if (entry->type == IS_NULL || ++entry->lookups < ZEPHIR_IN_ARRAY_INDEX_LOOKUPS) {
+			return -1;
+		}
+		zephir_in_array_cache_collect(zephir_globals_ptr);
+		zephir_in_array_cache_build(entry, haystack);
+		if (!entry->index) {
+			return -1;
+		}
+	}
+
+	/* Catches writes that skipped separation and changed the shape of the haystack */
+	if (UNEXPECTED(entry->data != haystack->arData || entry->used != haystack->nNumUsed
+		|| entry->elements != haystack->nNumOfElements || entry->next_free_element != haystack->nNextFreeElement)) {
+		zephir_in_array_cache_release(entry);
+		return -1;
+	}
+
+	if (entry->type != Z_TYPE_P(value)) {
+		return -1;
+	}
+
+	if (entry->lookups < ZEPHIR_IN_ARRAY_INDEX_LOOKUPS * 4) {
+		entry->lookups++;
+	}
+
+	if (Z_TYPE_P(value) == IS_STRING) {
+		return zend_hash_exists(entry->index, Z_STR_P(value));
+	}
+
+	return zend_hash_index_exists(entry->index, Z_LVAL_P(value));
+}
+
+/**
+ * Searches an integer in a packed array comparing the buckets in place
+ */
+static int zephir_in_array_packed_long(zval *value, zend_array *haystack)
+{
+	zend_long needle = Z_LVAL_P(value);
+	Bucket *p = haystack->arData, *end = p + haystack->nNumUsed;
+
+	for (; p != end; p++) {
+		if (EXPECTED(Z_TYPE(p->val) == IS_LONG)) {
+			if (Z_LVAL(p->val) == needle) {
+				return 1;
+			}
+		} else if (Z_TYPE(p->val) != IS_UNDEF && fast_equal_check_function(value, &p->val)) {
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
 /**
  * Fast in_array function
  */
@@ -786,17 +1163,24 @@ int zephir_fast_in_array(zval *value, zval *haystack)
 	zval *entry;
 	zend_ulong num_idx;
 	zend_string *str_idx;
+	int found;
 
 	if (Z_TYPE_P(haystack) != IS_ARRAY) {
 		return 0;
 	}
 
+	if ((found = zephir_in_array_cache_lookup(value, Z_ARRVAL_P(haystack))) >= 0) {
+		return found;
+	}
+
 	if (Z_TYPE_P(value) == IS_STRING) {
 		ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(haystack), num_idx, str_idx, entry) {
 			if (fast_equal_check_string(value, entry)) {
 				return 1;
 			}
 		} ZEND_HASH_FOREACH_END();
+	} else if (Z_TYPE_P(value) == IS_LONG && HT_IS_PACKED(Z_ARRVAL_P(haystack))) {
+		return zephir_in_array_packed_long(value, Z_ARRVAL_P(haystack));
 	} else {
 		ZEND_HASH_FOREACH_KEY_VAL(Z_ARRVAL_P(haystack), num_idx, str_idx, entry) {
 			if (fast_equal_check_function(value, entry)) {
@@ -837,3 +1221,256 @@ void zephir_fast_array_merge(zval *return_value, zval *array1, zval *array2)
 
 	php_array_merge(Z_ARRVAL_P(return_value), Z_ARRVAL_P(array2));
 }
+
+/**
+ * Reserves room for count more elements so appending them doesn't grow the table step by step
+ */
+static void zephir_array_reserve(HashTable *ht, uint32_t count)
+{
+	if (!(ht->u.flags & HASH_FLAG_INITIALIZED)) {
+		zend_hash_extend(ht, count, 1);
+	} else {
+		zend_hash_extend(ht, ht->nNumUsed + count, HT_IS_PACKED(ht));
+	}
+}
+
+/**
+ * Checks whether array_merge would leave the integer keys of an array untouched,
+ * that is, they already run from 0 in order and the next free one follows them
+ */
+static int zephir_array_is_merge_ordered(HashTable *ht)
+{
+	zend_ulong num_idx, expected = 0;
+	zend_string *str_idx;
+
+	if (HT_IS_PACKED(ht)) {
+		return ht->nNumUsed == ht->nNumOfElements && (zend_ulong) ht->nNextFreeElement == ht->nNumUsed;
+	}
+
+	/* Keys 0 to nNextFreeElement - 1 can't all be there with fewer elements than that */
+	if (ht->nNextFreeElement > 0 && (zend_ulong) ht->nNextFreeElement > ht->nNumOfElements) {
+		return 0;
+	}
+
+	ZEND_HASH_FOREACH_KEY(ht, num_idx, str_idx) {
+		if (!str_idx) {
+			if (num_idx != expected) {
+				return 0;
+			}
+			expected++;
+		}
+	} ZEND_HASH_FOREACH_END();
+
+	return (zend_ulong) ht->nNextFreeElement == expected;
+}
+
+/**
+ * Compiles let a = array_merge(a, b) extending a in place, a is only copied when it's shared
+ */
+void zephir_fast_array_merge_self(zval *array1, zval *array2)
+{
+	zval merged;
+
+	ZVAL_DEREF(array1);
+	if (Z_TYPE_P(array1) != IS_ARRAY || Z_TYPE_P(array2) != IS_ARRAY || Z_ARR_P(array1) == Z_ARR_P(array2) || !zephir_array_is_merge_ordered(Z_ARRVAL_P(array1))) {
+		zephir_fast_array_merge(&merged, array1, array2);
+		zval_ptr_dtor(array1);
+		ZVAL_COPY_VALUE(array1, &merged);
+		return;
+	}
+
+	zephir_in_array_cache_forget(Z_ARRVAL_P(array1));
+	SEPARATE_ARRAY(array1);
+	zephir_array_reserve(Z_ARRVAL_P(array1), zend_hash_num_elements(Z_ARRVAL_P(array2)));
+	php_array_merge(Z_ARRVAL_P(array1), Z_ARRVAL_P(array2));
+}
+
+/**
+ * Appends every element of an array at the end of the left array
+ */
+void zephir_merge_append(zval *left, zval *values)
+{
+	zval *tmp, held;
+
+	ZVAL_DEREF(left);
+	if (Z_TYPE_P(left) != IS_ARRAY) {
+		zend_error(E_NOTICE, "First parameter of zephir_merge_append must be an array");
+		return;
+	}
+
+	zephir_in_array_cache_forget(Z_ARRVAL_P(left));
+
+	if (Z_TYPE_P(values) != IS_ARRAY) {
+		SEPARATE_ARRAY(left);
+		Z_TRY_ADDREF_P(values);
+		add_next_index_zval(left, values);
+		return;
+	}
+
+	/* Appending an array to itself reads from the original while the copy grows */
+	ZVAL_COPY(&held, values);
+	SEPARATE_ARRAY(left);
+	zephir_array_reserve(Z_ARRVAL_P(left), zend_hash_num_elements(Z_ARRVAL(held)));
+
+	ZEND_HASH_FOREACH_VAL(Z_ARRVAL(held), tmp) {
+		ZVAL_DEREF(tmp);
+		Z_TRY_ADDREF_P(tmp);
+		add_next_index_zval(left, tmp);
+	} ZEND_HASH_FOREACH_END();
+
+	zval_ptr_dtor(&held);
+}
+
+/**
+ * Capacity of a native array buffer, growing it to the next power of two keeps appends amortized
+ * without having to store the capacity anywhere
+ */
+static size_t zephir_native_array_capacity(size_t length)
+{
+	size_t capacity = 16;
+
+	while (capacity < length) {
+		capacity <<= 1;
+	}
+
+	return capacity;
+}
+
+static zend_string *zephir_native_array_alloc(size_t length)
+{
+	zend_string *buffer = zend_string_alloc(zephir_native_array_capacity(length), 0);
+
+	ZSTR_LEN(buffer) = length;
+	return buffer;
+}
+
+static size_t zephir_native_array_elem_size(zend_uchar type)
+{
+	switch (type) {
+		case IS_LONG:
+			return sizeof(zend_long);
+		case IS_DOUBLE:
+			return sizeof(double);
+		default:
+			return sizeof(zend_bool);
+	}
+}
+
+void zephir_native_array_out_of_range(zend_long index)
+{
+	zend_error(E_WARNING, "Index " ZEND_LONG_FMT " is out of range of the native array", index);
+}
+
+/**
+ * Converts the values of a PHP array into the elements of a native array, keys are discarded
+ */
+void zephir_native_array_from_zval(zval *native, zval *arr, zend_uchar type)
+{
+	zend_string *buffer;
+	zval *value;
+	size_t i = 0;
+
+	ZVAL_DEREF(arr);
+	if (Z_TYPE_P(arr) != IS_ARRAY) {
+		zend_error(E_WARNING, "Only arrays can be converted to native arrays");
+		ZVAL_NULL(native);
+		return;
+	}
+
+	buffer = zephir_native_array_alloc(zend_hash_num_elements(Z_ARRVAL_P(arr)) * zephir_native_array_elem_size(type));
+
+	ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(arr), value) {
+		switch (type) {
+			case IS_LONG:
+				((zend_long *) ZSTR_VAL(buffer))[i++] = zval_get_long(value);
+				break;
+			case IS_DOUBLE:
+				((double *) ZSTR_VAL(buffer))[i++] = zval_get_double(value);
+				break;
+			default:
+				((zend_bool *) ZSTR_VAL(buffer))[i++] = (zend_bool) zend_is_true(value);
+				break;
+		}
+	} ZEND_HASH_FOREACH_END();
+
+	ZVAL_NEW_STR(native, buffer);
+}
+
+/**
+ * Builds a packed PHP array with the elements of a native array
+ */
+void zephir_native_array_to_zval(zval *return_value, const zval *native, zend_uchar type)
+{
+	size_t i, count = 0;
+	zval value;
+
+	if (Z_TYPE_P(native) == IS_STRING) {
+		count = Z_STRLEN_P(native) / zephir_native_array_elem_size(type);
+	}
+
+	array_init_size(return_value, count);
+	if (!count) {
+		return;
+	}
+
+	zend_hash_real_init(Z_ARRVAL_P(return_value), 1);
+	ZEND_HASH_FILL_PACKED(Z_ARRVAL_P(return_value)) {
+		for (i = 0; i < count; i++) {
+			switch (type) {
+				case IS_LONG:
+					ZVAL_LONG(&value, ((zend_long *) Z_STRVAL_P(native))[i]);
+					break;
+				case IS_DOUBLE:
+					ZVAL_DOUBLE(&value, ((double *) Z_STRVAL_P(native))[i]);
+					break;
+				default:
+					ZVAL_BOOL(&value, ((zend_bool *) Z_STRVAL_P(native))[i]);
+					break;
+			}
+			ZEND_HASH_FILL_ADD(&value);
+		}
+	} ZEND_HASH_FILL_END();
+}
+
+/**
+ * Makes the buffer of a native array owned by the variable before writing to it
+ */
+char *zephir_native_array_separate(zval *native)
+{
+	zend_string *buffer;
+
+	if (UNEXPECTED(Z_REFCOUNT_P(native) > 1)) {
+		buffer = zephir_native_array_alloc(Z_STRLEN_P(native));
+		memcpy(ZSTR_VAL(buffer), Z_STRVAL_P(native), Z_STRLEN_P(native));
+		Z_DELREF_P(native);
+		ZVAL_NEW_STR(native, buffer);
+	}
+
+	return Z_STRVAL_P(native);
+}
+
+/**
+ * Adds room for one element at the end of a native array and returns its address
+ */
+char *zephir_native_array_grow(zval *native, size_t size)
+{
+	zend_string *buffer;
+	size_t length;
+
+	if (Z_TYPE_P(native) != IS_STRING) {
+		zval_ptr_dtor(native);
+		ZVAL_NEW_STR(native, zephir_native_array_alloc(size));
+		return Z_STRVAL_P(native);
+	}
+
+	length = Z_STRLEN_P(native);
+	zephir_native_array_separate(native);
+
+	if (zephir_native_array_capacity(length + size) > zephir_native_array_capacity(length)) {
+		buffer = zend_string_realloc(Z_STR_P(native), zephir_native_array_capacity(length + size), 0);
+		ZVAL_NEW_STR(native, buffer);
+	}
+
+	Z_STRLEN_P(native) = length + size;
+	return Z_STRVAL_P(native) + length;
+}
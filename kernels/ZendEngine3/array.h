@@ -27,17 +27,86 @@
 #include "kernel/globals.h"
 #include "kernel/main.h"
 
+#ifndef HT_IS_PACKED
+#define HT_IS_PACKED(ht) (((ht)->u.flags & HASH_FLAG_PACKED) != 0)
+#endif
+
+/**
+ * Looks up an integer index addressing the bucket directly when the array is packed,
+ * other arrays go through zend_hash_index_find
+ */
+static zend_always_inline zval *zephir_hash_index_find(const HashTable *ht, zend_ulong index)
+{
+	zval *zv;
+
+	if (EXPECTED(HT_IS_PACKED(ht))) {
+		if (EXPECTED(index < ht->nNumUsed)) {
+			zv = &ht->arData[index].val;
+			if (EXPECTED(Z_TYPE_P(zv) != IS_UNDEF)) {
+				return zv;
+			}
+		}
+		return NULL;
+	}
+
+	return zend_hash_index_find(ht, index);
+}
+
+/**
+ * Replaces an existing element of a packed array or appends right after its last element
+ * without going through zend_hash_index_update, returns NULL when the generic path is needed
+ */
+static zend_always_inline zval *zephir_hash_packed_update(HashTable *ht, zend_ulong index, zval *value)
+{
+	zval garbage, *zv;
+	Bucket *p;
+
+	if (UNEXPECTED(!HT_IS_PACKED(ht) || ht->pDestructor != ZVAL_PTR_DTOR)) {
+		return NULL;
+	}
+
+	if (EXPECTED(index < ht->nNumUsed)) {
+		zv = &ht->arData[index].val;
+		if (UNEXPECTED(Z_TYPE_P(zv) == IS_UNDEF)) {
+			return NULL;
+		}
+		ZVAL_COPY_VALUE(&garbage, zv);
+		ZVAL_COPY_VALUE(zv, value);
+		zval_ptr_dtor(&garbage);
+		return zv;
+	}
+
+	if (index == ht->nNumUsed && (zend_long) index == ht->nNextFreeElement && index < ht->nTableSize) {
+		p = ht->arData + index;
+		ht->nNumUsed = index + 1;
+		ht->nNumOfElements++;
+		if (ht->nInternalPointer == HT_INVALID_IDX) {
+			ht->nInternalPointer = index;
+		}
+		zend_hash_iterators_update(ht, HT_INVALID_IDX, index);
+		ht->nNextFreeElement = index + 1;
+		p->h = index;
+		p->key = NULL;
+		ZVAL_COPY_VALUE(&p->val, value);
+		return &p->val;
+	}
+
+	return NULL;
+}
+
 void ZEPHIR_FASTCALL zephir_create_array(zval *return_value, uint size, int initialize);
 
 /** Combined isset/fetch */
 int zephir_array_isset_fetch(zval *fetched, const zval *arr, zval *index, int readonly);
 int zephir_array_isset_string_fetch(zval *fetched, zval *arr, char *index, uint index_length, int readonly);
 int zephir_array_isset_long_fetch(zval *fetched, zval *arr, unsigned long index, int readonly);
+int zephir_array_isset_str_fetch(zval *fetched, zval *arr, zend_string *index, int readonly);
 
 /** Check for index existence */
 int ZEPHIR_FASTCALL zephir_array_isset(const zval *arr, zval *index);
 int ZEPHIR_FASTCALL zephir_array_isset_long(const zval *arr, unsigned long index);
 int ZEPHIR_FASTCALL zephir_array_isset_string(const zval *arr, const char *index, uint index_length);
+int ZEPHIR_FASTCALL zephir_array_isset_str(const zval *arr, zend_string *index);
 
 /** Unset existing indexes */
 int ZEPHIR_FASTCALL zephir_array_unset(zval *arr, zval *index, int flags);
@@ -48,6 +117,7 @@ int ZEPHIR_FASTCALL zephir_array_unset_string(zval *arr, const char *index, uint
 int zephir_array_fetch(zval *return_value, zval *arr, zval *index, int flags ZEPHIR_DEBUG_PARAMS);
 int zephir_array_fetch_string(zval *return_value, zval *arr, const char *index, uint index_length, int flags ZEPHIR_DEBUG_PARAMS);
 int zephir_array_fetch_long(zval *return_value, zval *arr, unsigned long index, int flags ZEPHIR_DEBUG_PARAMS);
+int zephir_array_fetch_str(zval *return_value, zval *arr, zend_string *index, int flags ZEPHIR_DEBUG_PARAMS);
 
 /** Append elements to arrays */
 int zephir_array_append(zval *arr, zval *value, int separate ZEPHIR_DEBUG_PARAMS);
@@ -64,14 +134,65 @@ int zephir_array_key_exists(zval *arr, zval *key);
 void zephir_array_update_multi_ex(zval *arr, zval *value, const char *types, int types_length, int types_count, va_list ap);
 int zephir_array_update_multi(zval *arr, zval *value, const char *types, int types_length, int types_count, ...);
 
+/* Update array through specialized per-level fetches */
+zval *zephir_array_nested_root(zval *arr);
+zval *zephir_array_nested_long(zval *arr, zend_ulong index);
+zval *zephir_array_nested_string(zval *arr, const char *index, uint index_length);
+zval *zephir_array_nested_zval(zval *arr, zval *index);
+
 /** Fast Array Merge */
 void zephir_fast_array_merge(zval *return_value, zval *array1, zval *array2);
+void zephir_fast_array_merge_self(zval *array1, zval *array2);
+void zephir_merge_append(zval *left, zval *values);
 
 /* In Array */
 int zephir_fast_in_array(zval *needle, zval *haystack);
+void zephir_in_array_cache_destroy(void);
 
 #define zephir_array_fast_append(arr, value) \
   Z_TRY_ADDREF_P(value); \
   zend_hash_next_index_insert(Z_ARRVAL_P(arr), value);
 
+/**
+ * Native typed arrays (int[], double[], bool[]) keep their elements in a contiguous buffer,
+ * the buffer is a zend_string held by the variable so it's released by the memory frame
+ */
+void zephir_native_array_from_zval(zval *native, zval *arr, zend_uchar type);
+void zephir_native_array_to_zval(zval *return_value, const zval *native, zend_uchar type);
+char *zephir_native_array_separate(zval *native);
+char *zephir_native_array_grow(zval *native, size_t size);
+void zephir_native_array_out_of_range(zend_long index);
+
+#define ZEPHIR_NATIVE_ARRAY_ACCESSORS(name, ctype) \
+	static zend_always_inline zend_long zephir_native_##name##_count(const zval *native) \
+	{ \
+		return Z_TYPE_P(native) == IS_STRING ? (zend_long) (Z_STRLEN_P(native) / sizeof(ctype)) : 0; \
+	} \
+	static zend_always_inline ctype zephir_native_##name##_get(const zval *native, zend_long index) \
+	{ \
+		if (EXPECTED(index >= 0 && index < zephir_native_##name##_count(native))) { \
+			return ((ctype *) Z_STRVAL_P(native))[index]; \
+		} \
+		zephir_native_array_out_of_range(index); \
+		return 0; \
+	} \
+	static zend_always_inline void zephir_native_##name##_append(zval *native, ctype value) \
+	{ \
+		*((ctype *) zephir_native_array_grow(native, sizeof(ctype))) = value; \
+	} \
+	static zend_always_inline void zephir_native_##name##_set(zval *native, zend_long index, ctype value) \
+	{ \
+		if (EXPECTED(index >= 0 && index < zephir_native_##name##_count(native))) { \
+			((ctype *) zephir_native_array_separate(native))[index] = value; \
+		} else if (index == zephir_native_##name##_count(native)) { \
+			zephir_native_##name##_append(native, value); \
+		} else { \
+			zephir_native_array_out_of_range(index); \
+		} \
+	}
+
+ZEPHIR_NATIVE_ARRAY_ACCESSORS(long, zend_long)
+ZEPHIR_NATIVE_ARRAY_ACCESSORS(double, double)
+ZEPHIR_NATIVE_ARRAY_ACCESSORS(bool, zend_bool)
+
 #endif /* ZEPHIR_KERNEL_ARRAY_H */
@@ -33,15 +33,68 @@
 #include "kernel/exception.h"
 #include "kernel/backtrace.h"
 
-int zephir_call_func_aparams_fast(zval *return_value_ptr, zephir_fcall_cache_entry **cache_entry, zend_uint param_count, zval *params[])
+/**
+ * Writes the arguments straight into the slots of the callee frame,
+ * temporaries handed over by the call site (flagged in param_moves) are moved instead of copied
+ */
+static zend_always_inline void zephir_fcall_send_args(zend_execute_data *call, zend_function *func, uint32_t param_count, zval *params[], zend_uint param_moves)
 {
 	uint32_t i;
+	zval *param = ZEND_CALL_ARG(call, 1);
+
+	for (i = 0; i < param_count; i++, param++) {
+		zval *arg = params[i];
+
+		if (ZEPHIR_PARAM_IS_MOVED(param_moves, i) && EXPECTED(!ARG_SHOULD_BE_SENT_BY_REF(func, i + 1))) {
+			ZVAL_COPY_VALUE(param, arg);
+			ZVAL_NULL(arg);
+			continue;
+		}
+
+		if (ARG_SHOULD_BE_SENT_BY_REF(func, i + 1)) {
+			if (UNEXPECTED(!Z_ISREF_P(arg))) {
+				ZVAL_NEW_REF(arg, arg);
+			}
+			Z_ADDREF_P(arg);
+		} else {
+			if (Z_ISREF_P(arg) &&
+			    !(func->common.fn_flags & ZEND_ACC_CALL_VIA_TRAMPOLINE)) {
+				/* don't separate references for __call */
+				arg = Z_REFVAL_P(arg);
+			}
+			if (Z_OPT_REFCOUNTED_P(arg)) {
+				Z_ADDREF_P(arg);
+			}
+		}
+		ZVAL_COPY_VALUE(param, arg);
+	}
+}
+
+int zephir_call_func_aparams_fast(zval *return_value_ptr, zephir_fcall_cache_entry **cache_entry, zend_uint param_count, zval *params[], zend_uint param_moves)
+{
 	zend_class_entry *calling_scope = NULL;
 	zend_execute_data *call, dummy_execute_data;
 	zval retval_local;
 	zval *retval_ptr = return_value_ptr ? return_value_ptr : &retval_local;
 	zend_class_entry *orig_scope;
 	zend_function *func;
+#ifdef ZEPHIR_FCALL_PROFILE
+	zephir_fcall_site *profile_site;
+	double profile_start;
+#endif
+
+#ifndef ZEPHIR_RELEASE
+	func = (*cache_entry)->f;
+	++(*cache_entry)->times;
+#else
+	func = *cache_entry;
+#endif
+
+#ifdef ZEPHIR_FCALL_PROFILE
+	/* Consumed before releasing the return value, its destructor may perform other calls */
+	profile_site = zephir_fcall_profile_site(ZSTR_VAL(func->common.function_name), ZSTR_LEN(func->common.function_name));
+	profile_start = zephir_fcall_profile_time();
+#endif
 
 	if (return_value_ptr) {
 		zval_ptr_dtor(return_value_ptr);
@@ -83,57 +136,9 @@ int zephir_call_func_aparams_fast(zval *return_value_ptr, zephir_fcall_cache_ent
 		EG(current_execute_data) = &dummy_execute_data;
 	}
 
-#ifndef ZEPHIR_RELEASE
-	func = (*cache_entry)->f;
-	++(*cache_entry)->times;
-#else
-	func = *cache_entry;
-#endif
-
 	calling_scope = NULL;
 	call = zend_vm_stack_push_call_frame(ZEND_CALL_TOP_FUNCTION, func, param_count, NULL, NULL);
-
-	for (i = 0; i < param_count; i++) {
-		zval *param;
-		zval *arg = params[i];
-
-		if (ARG_SHOULD_BE_SENT_BY_REF(func, i + 1)) {
-			if (!Z_ISREF_P(arg)) {
-				/*if (!ARG_MAY_BE_SENT_BY_REF(func, i + 1)) {
-					if (i) {
-						// hack to clean up the stack
-						ZEND_CALL_NUM_ARGS(call) = i;
-						zend_vm_stack_free_args(call);
-					}
-					zend_vm_stack_free_call_frame(call);
-
-					zend_error(E_WARNING, "Parameter %d to %s%s%s() expected to be a reference, value given",
-						i+1,
-						func->common.scope ? ZSTR_VAL(func->common.scope->name) : "",
-						func->common.scope ? "::" : "",
-						ZSTR_VAL(func->common.function_name));
-					if (EG(current_execute_data) == &dummy_execute_data) {
-						EG(current_execute_data) = dummy_execute_data.prev_execute_data;
-					}
-					return FAILURE;
-				}*/
-
-				ZVAL_NEW_REF(arg, arg);
-			}
-			Z_ADDREF_P(arg);
-		} else {
-			if (Z_ISREF_P(arg) &&
-			    !(func->common.fn_flags & ZEND_ACC_CALL_VIA_TRAMPOLINE)) {
-				/* don't separate references for __call */
-				arg = Z_REFVAL_P(arg);
-			}
-			if (Z_OPT_REFCOUNTED_P(arg)) {
-				Z_ADDREF_P(arg);
-			}
-		}
-		param = ZEND_CALL_ARG(call, i+1);
-		ZVAL_COPY_VALUE(param, arg);
-	}
+	zephir_fcall_send_args(call, func, param_count, params, param_moves);
 
 	EG(scope) = calling_scope;
 	Z_OBJ(call->This) = NULL;
@@ -213,12 +218,121 @@ int zephir_call_func_aparams_fast(zval *return_value_ptr, zephir_fcall_cache_ent
 		EG(current_execute_data) = dummy_execute_data.prev_execute_data;
 	}
 
+#ifdef ZEPHIR_FCALL_PROFILE
+	zephir_fcall_profile_record(profile_site, ZEPHIR_FCALL_PROFILE_HIT, NULL, profile_start);
+#endif
+
 	if (EG(exception)) {
 		zend_throw_exception_internal(NULL);
 	}
 	return SUCCESS;
 }
 
+#ifndef ZTS
+/* Internal functions live as long as the process, so their lookups are never invalidated */
+static zend_function *zephir_internal_functions[ZEPHIR_MAX_CACHE_SLOTS];
+#endif
+
+/**
+ * Resolves a function implemented in C by its lowercased name, deprecated functions aren't resolved
+ * so they are called through zend_call_function, which raises their E_DEPRECATED notice
+ */
+static zend_function *zephir_lookup_internal_function(const char *func_name, uint func_length, int func_slot)
+{
+	zend_function *func;
+
+#ifndef ZTS
+	if (func_slot > 0 && func_slot < ZEPHIR_MAX_CACHE_SLOTS && zephir_internal_functions[func_slot]) {
+		return zephir_internal_functions[func_slot];
+	}
+#endif
+
+	func = zend_hash_str_find_ptr(EG(function_table), func_name, func_length);
+	if (!func || func->type != ZEND_INTERNAL_FUNCTION || (func->common.fn_flags & ZEND_ACC_DEPRECATED)) {
+		return NULL;
+	}
+
+#ifndef ZTS
+	if (func_slot > 0 && func_slot < ZEPHIR_MAX_CACHE_SLOTS) {
+		zephir_internal_functions[func_slot] = func;
+	}
+#endif
+
+	return func;
+}
+
+/**
+ * Calls a function implemented in C through its handler using a frame sized to the number of parameters,
+ * parameters are written straight into the slots of the frame
+ */
+int zephir_call_internal_func_aparams(zval *return_value_ptr, const char *func_name, uint func_length, int func_slot, uint param_count, zval **params, zend_uint param_moves)
+{
+	zend_execute_data *call;
+	zend_class_entry *orig_scope;
+	zend_function *func;
+	zval rv, *rvp = return_value_ptr ? return_value_ptr : &rv;
+#ifdef ZEPHIR_FCALL_PROFILE
+	zephir_fcall_site *profile_site;
+	double profile_start;
+#endif
+
+	func = zephir_lookup_internal_function(func_name, func_length, func_slot);
+	if (UNEXPECTED(!func || !EG(current_execute_data))) {
+		return zephir_call_func_aparams(return_value_ptr, func_name, func_length, NULL, 0, param_count, params, param_moves);
+	}
+
+	if (UNEXPECTED(EG(exception))) {
+		ZEPHIR_FCALL_PROFILE_CLEAR();
+		return FAILURE;
+	}
+
+#ifdef ZEPHIR_FCALL_PROFILE
+	profile_site = zephir_fcall_profile_site(func_name, func_length);
+	profile_start = zephir_fcall_profile_time();
+#endif
+
+	call = zend_vm_stack_push_call_frame(ZEND_CALL_TOP_FUNCTION, func, param_count, NULL, NULL);
+
+	zephir_fcall_send_args(call, func, param_count, params, param_moves);
+
+	orig_scope = EG(scope);
+	EG(scope) = func->common.scope;
+
+	call->prev_execute_data = EG(current_execute_data);
+	call->return_value = NULL;
+	EG(current_execute_data) = call;
+
+	ZVAL_NULL(rvp);
+	if (EXPECTED(zend_execute_internal == NULL)) {
+		func->internal_function.handler(call, rvp);
+	} else {
+		zend_execute_internal(call, rvp);
+	}
+
+	EG(current_execute_data) = call->prev_execute_data;
+	EG(scope) = orig_scope;
+
+	zend_vm_stack_free_args(call);
+	zend_vm_stack_free_call_frame(call);
+
+#ifdef ZEPHIR_FCALL_PROFILE
+	zephir_fcall_profile_record(profile_site, ZEPHIR_FCALL_PROFILE_HIT, NULL, profile_start);
+#endif
+
+	if (UNEXPECTED(EG(exception))) {
+		zval_ptr_dtor(rvp);
+		ZVAL_UNDEF(rvp);
+		zend_throw_exception_internal(NULL);
+		return FAILURE;
+	}
+
+	if (!return_value_ptr) {
+		zval_ptr_dtor(&rv);
+	}
+
+	return SUCCESS;
+}
+
 static int zephir_is_callable_check_class(const char *name, int name_len, zend_fcall_info_cache *fcc, int *strict_class, char **error) /* {{{ */
 {
 	int ret = 0;
@@ -692,8 +806,14 @@ static zend_bool zephir_is_callable_ex(zval *callable, zend_object *object, uint
 static zend_bool zephir_is_info_dynamic_callable(zephir_fcall_info *info, zend_fcall_info_cache *fcc, zend_class_entry *ce_org, int strict_class)
 {
 	int call_via_handler = 0, retval = 0;
-	zend_string *zs_lcname = zend_string_alloc(info->func_length, 0);
-	zend_str_tolower_copy(ZSTR_VAL(zs_lcname), info->func_name, info->func_length);
+	zend_string *zs_lcname;
+
+	if (info->func_str) {
+		zs_lcname = zend_string_copy(info->func_str);
+	} else {
+		zs_lcname = zend_string_alloc(info->func_length, 0);
+		zend_str_tolower_copy(ZSTR_VAL(zs_lcname), info->func_name, info->func_length);
+	}
 
 	if (fcc->object && fcc->calling_scope == ce_org) {
 		if (strict_class && ce_org->__call) {
@@ -952,9 +1072,8 @@ static zend_bool zephir_is_info_callable_ex(zephir_fcall_info *info, zend_fcall_
 	return retval;
 }
 
-int zephir_call_function_opt(zend_fcall_info *fci, zend_fcall_info_cache *fci_cache, zephir_fcall_info *info, zval *params[])
+int zephir_call_function_opt(zend_fcall_info *fci, zend_fcall_info_cache *fci_cache, zephir_fcall_info *info, zval *params[], zend_uint param_moves)
 {
-	uint32_t i;
 	zend_class_entry *calling_scope = NULL;
 	zend_execute_data *call, dummy_execute_data;
 	zend_fcall_info_cache fci_cache_local;
@@ -1066,48 +1185,7 @@ int zephir_call_function_opt(zend_fcall_info *fci, zend_fcall_info_cache *fci_ca
 		}
 	}
 
-	for (i=0; i<fci->param_count; i++) {
-		zval *param;
-		zval *arg = params[i];
-
-		if (ARG_SHOULD_BE_SENT_BY_REF(func, i + 1)) {
-			if (UNEXPECTED(!Z_ISREF_P(arg))) {
-				/*if (fci->no_separation &&
-					!ARG_MAY_BE_SENT_BY_REF(func, i + 1)) {
-					if (i) {
-						// hack to clean up the stack
-						ZEND_CALL_NUM_ARGS(call) = i;
-						zend_vm_stack_free_args(call);
-					}
-					zend_vm_stack_free_call_frame(call);
-
-					zend_error(E_WARNING, "Parameter %d to %s%s%s() expected to be a reference, value given",
-						i+1,
-						func->common.scope ? ZSTR_VAL(func->common.scope->name) : "",
-						func->common.scope ? "::" : "",
-						ZSTR_VAL(func->common.function_name));
-					if (EG(current_execute_data) == &dummy_execute_data) {
-						EG(current_execute_data) = dummy_execute_data.prev_execute_data;
-					}
-					return FAILURE;
-				} */
-
-				ZVAL_NEW_REF(arg, arg);
-			}
-			Z_ADDREF_P(arg);
-		} else {
-			if (Z_ISREF_P(arg) &&
-			    !(func->common.fn_flags & ZEND_ACC_CALL_VIA_TRAMPOLINE)) {
-				/* don't separate references for __call */
-				arg = Z_REFVAL_P(arg);
-			}
-			if (Z_OPT_REFCOUNTED_P(arg)) {
-				Z_ADDREF_P(arg);
-			}
-		}
-		param = ZEND_CALL_ARG(call, i+1);
-		ZVAL_COPY_VALUE(param, arg);
-	}
+	zephir_fcall_send_args(call, func, fci->param_count, params, param_moves);
 
 	EG(scope) = calling_scope;
 	if (func->common.fn_flags & ZEND_ACC_STATIC) {
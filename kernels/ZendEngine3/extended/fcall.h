@@ -35,9 +35,10 @@ typedef struct _zephir_fcall_info {
   int class_length;
   const char *func_name;
   int func_length;
+  zend_string *func_str; /* interned lowercase name of the method, when the call site has one */
 } zephir_fcall_info;
 
-int zephir_call_function_opt(zend_fcall_info *fci, zend_fcall_info_cache *fci_cache, zephir_fcall_info *info, zval **params);
-int zephir_call_func_aparams_fast(zval *return_value_ptr, zephir_fcall_cache_entry **cache_entry, uint param_count, zval **params);
+int zephir_call_function_opt(zend_fcall_info *fci, zend_fcall_info_cache *fci_cache, zephir_fcall_info *info, zval **params, zend_uint param_moves);
+int zephir_call_func_aparams_fast(zval *return_value_ptr, zephir_fcall_cache_entry **cache_entry, uint param_count, zval **params, zend_uint param_moves);
 
 #endif
@@ -24,6 +24,7 @@
 #include <Zend/zend_API.h>
 #include <Zend/zend_exceptions.h>
 #include <Zend/zend_execute.h>
+#include <Zend/zend_closures.h>
 
 #include "kernel/main.h"
 #include "kernel/fcall.h"
@@ -53,6 +54,262 @@ static const unsigned char tolower_map[256] = {
 	0xF0, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8, 0xF9, 0xFA, 0xFB, 0xFC, 0xFD, 0xFE, 0xFF
 };
 
+#ifdef ZEPHIR_FCALL_PROFILE
+
+#include <sys/time.h>
+
+#define ZEPHIR_FCALL_PROFILE_BUCKETS 1024
+#define ZEPHIR_FCALL_PROFILE_CLASSES 4
+
+struct _zephir_fcall_site {
+	const char *file;
+	int line;
+	char *name;
+	unsigned long hits;
+	unsigned long misses;
+	unsigned long slow;
+	unsigned long megamorphic;
+	char *classes[ZEPHIR_FCALL_PROFILE_CLASSES];
+	unsigned long class_calls[ZEPHIR_FCALL_PROFILE_CLASSES];
+	double time;
+	struct _zephir_fcall_site *next;
+};
+
+const char *zephir_fcall_profile_file = NULL;
+int zephir_fcall_profile_line = 0;
+unsigned long zephir_fcall_profile_stale = 0;
+
+static zephir_fcall_site *zephir_fcall_sites[ZEPHIR_FCALL_PROFILE_BUCKETS];
+static unsigned long zephir_fcall_sites_count = 0;
+
+static char *zephir_fcall_profile_strdup(const char *str, size_t length)
+{
+	char *copy = malloc(length + 1);
+	if (copy) {
+		memcpy(copy, str, length);
+		copy[length] = '\0';
+	}
+	return copy;
+}
+
+double zephir_fcall_profile_time(void)
+{
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+	return (double) tv.tv_sec + (double) tv.tv_usec / 1000000.0;
+}
+
+/**
+ * Returns the call site that performs the current call, consuming the mark left by the call macros
+ */
+zephir_fcall_site *zephir_fcall_profile_site(const char *name, size_t name_length)
+{
+	zephir_fcall_site *site;
+	const char *file = zephir_fcall_profile_file;
+	int line = zephir_fcall_profile_line;
+	size_t bucket;
+
+	if (!file) {
+		file = "[unknown]";
+		line = 0;
+	}
+	zephir_fcall_profile_file = NULL;
+
+	bucket = (((size_t) file >> 3) ^ (size_t) line) % ZEPHIR_FCALL_PROFILE_BUCKETS;
+	for (site = zephir_fcall_sites[bucket]; site; site = site->next) {
+		if (site->file == file && site->line == line) {
+			return site;
+		}
+	}
+
+	site = calloc(1, sizeof(zephir_fcall_site));
+	if (!site) {
+		return NULL;
+	}
+
+	site->file = file;
+	site->line = line;
+	if (name) {
+		site->name = zephir_fcall_profile_strdup(name, name_length);
+	} else {
+		site->name = zephir_fcall_profile_strdup("[dynamic]", sizeof("[dynamic]") - 1);
+	}
+
+	site->next = zephir_fcall_sites[bucket];
+	zephir_fcall_sites[bucket] = site;
+	zephir_fcall_sites_count++;
+	return site;
+}
+
+/**
+ * Accounts a call in its site: the path taken to resolve the function, the receiver class and the time spent
+ */
+void zephir_fcall_profile_record(zephir_fcall_site *site, int path, const zend_class_entry *ce, double start)
+{
+	int i;
+
+	if (!site) {
+		return;
+	}
+
+	switch (path) {
+		case ZEPHIR_FCALL_PROFILE_HIT:
+			site->hits++;
+			break;
+		case ZEPHIR_FCALL_PROFILE_MISS:
+			site->misses++;
+			break;
+		default:
+			site->slow++;
+			break;
+	}
+
+	site->time += zephir_fcall_profile_time() - start;
+
+	if (!ce) {
+		return;
+	}
+
+	for (i = 0; i < ZEPHIR_FCALL_PROFILE_CLASSES; i++) {
+		if (!site->classes[i]) {
+			site->classes[i] = zephir_fcall_profile_strdup(ZSTR_VAL(ce->name), ZSTR_LEN(ce->name));
+			site->class_calls[i] = 1;
+			return;
+		}
+		if (!strcmp(site->classes[i], ZSTR_VAL(ce->name))) {
+			site->class_calls[i]++;
+			return;
+		}
+	}
+
+	site->megamorphic++;
+}
+
+static int zephir_fcall_profile_compare(const void *a, const void *b)
+{
+	const zephir_fcall_site *site_a = *((const zephir_fcall_site **) a);
+	const zephir_fcall_site *site_b = *((const zephir_fcall_site **) b);
+
+	if (site_a->time < site_b->time) {
+		return 1;
+	}
+	if (site_a->time > site_b->time) {
+		return -1;
+	}
+	return 0;
+}
+
+static void zephir_fcall_profile_json_string(FILE *stream, const char *str)
+{
+	fputc('"', stream);
+	for (; *str; str++) {
+		switch (*str) {
+			case '"':
+			case '\\':
+				fputc('\\', stream);
+				fputc(*str, stream);
+				break;
+			default:
+				if ((unsigned char) *str < 0x20) {
+					fprintf(stream, "\\u%04x", (unsigned char) *str);
+				} else {
+					fputc(*str, stream);
+				}
+				break;
+		}
+	}
+	fputc('"', stream);
+}
+
+/**
+ * Writes the call sites sorted by the cumulative time spent on them, as a plain report or JSON,
+ * followed by the number of marks that were never consumed
+ */
+void zephir_fcall_profile_dump(FILE *stream, int json)
+{
+	zephir_fcall_site **sites = NULL, *site;
+	unsigned long i, n = 0;
+	int j;
+
+	if (zephir_fcall_sites_count) {
+		sites = malloc(sizeof(zephir_fcall_site *) * zephir_fcall_sites_count);
+		if (!sites) {
+			return;
+		}
+	}
+
+	for (i = 0; i < ZEPHIR_FCALL_PROFILE_BUCKETS; i++) {
+		for (site = zephir_fcall_sites[i]; site; site = site->next) {
+			sites[n++] = site;
+		}
+	}
+
+	if (n) {
+		qsort(sites, n, sizeof(zephir_fcall_site *), zephir_fcall_profile_compare);
+	}
+
+	if (json) {
+		fputs("{\"sites\":[", stream);
+		for (i = 0; i < n; i++) {
+			site = sites[i];
+			fputs(i ? ",\n{\"file\":" : "\n{\"file\":", stream);
+			zephir_fcall_profile_json_string(stream, site->file);
+			fprintf(stream, ",\"line\":%d,\"callee\":", site->line);
+			zephir_fcall_profile_json_string(stream, site->name);
+			fprintf(stream, ",\"hits\":%lu,\"misses\":%lu,\"slow\":%lu,\"time\":%.6f,\"megamorphic\":%lu,\"classes\":{",
+				site->hits, site->misses, site->slow, site->time, site->megamorphic);
+			for (j = 0; j < ZEPHIR_FCALL_PROFILE_CLASSES && site->classes[j]; j++) {
+				if (j) {
+					fputc(',', stream);
+				}
+				zephir_fcall_profile_json_string(stream, site->classes[j]);
+				fprintf(stream, ":%lu", site->class_calls[j]);
+			}
+			fputs("}}", stream);
+		}
+		fprintf(stream, "\n],\n\"stale\":%lu}\n", zephir_fcall_profile_stale);
+	} else {
+		fprintf(stream, "%-12s %-10s %-10s %-10s %-40s %s\n", "time (ms)", "hits", "misses", "slow", "callee", "site");
+		for (i = 0; i < n; i++) {
+			site = sites[i];
+			fprintf(stream, "%-12.3f %-10lu %-10lu %-10lu %-40s %s:%d\n",
+				site->time * 1000.0, site->hits, site->misses, site->slow, site->name, site->file, site->line);
+			for (j = 0; j < ZEPHIR_FCALL_PROFILE_CLASSES && site->classes[j]; j++) {
+				fprintf(stream, "%-46s %-10lu %s\n", "", site->class_calls[j], site->classes[j]);
+			}
+			if (site->megamorphic) {
+				fprintf(stream, "%-46s %-10lu %s\n", "", site->megamorphic, "[other classes]");
+			}
+		}
+		fprintf(stream, "stale marks: %lu\n", zephir_fcall_profile_stale);
+	}
+
+	free(sites);
+}
+
+void zephir_fcall_profile_shutdown(void)
+{
+	zephir_fcall_site *site, *next;
+	int i, j;
+
+	for (i = 0; i < ZEPHIR_FCALL_PROFILE_BUCKETS; i++) {
+		for (site = zephir_fcall_sites[i]; site; site = next) {
+			next = site->next;
+			for (j = 0; j < ZEPHIR_FCALL_PROFILE_CLASSES; j++) {
+				free(site->classes[j]);
+			}
+			free(site->name);
+			free(site);
+		}
+		zephir_fcall_sites[i] = NULL;
+	}
+
+	zephir_fcall_sites_count = 0;
+}
+
+#endif
+
 int zephir_has_constructor_ce(const zend_class_entry *ce)
 {
 	while (ce) {
@@ -348,7 +605,7 @@ ZEPHIR_ATTR_NONNULL static void zephir_fcall_populate_fci_cache(zend_fcall_info_
  */
 int zephir_call_user_function(zval *object_pp, zend_class_entry *obj_ce, zephir_call_type type,
 	zval *function_name, zval *retval_ptr, zephir_fcall_cache_entry **cache_entry, int cache_slot, zend_uint param_count,
-	zval *params[], zephir_fcall_info *info)
+	zval *params[], zend_uint param_moves, zephir_fcall_info *info)
 {
 	zval local_retval_ptr;
 	int status;
@@ -361,10 +618,26 @@ int zephir_call_user_function(zval *object_pp, zend_class_entry *obj_ce, zephir_
 	zephir_fcall_cache_entry *temp_cache_entry = NULL;
 	zend_class_entry *old_scope = EG(scope);
 	int reload_cache = 1;
+#ifdef ZEPHIR_FCALL_PROFILE
+	zephir_fcall_site *profile_site;
+	int profile_path;
+	double profile_start;
+#endif
 
 	assert(obj_ce || !object_pp);
 	ZVAL_UNDEF(&local_retval_ptr);
 
+#ifdef ZEPHIR_FCALL_PROFILE
+	/* Consumed before releasing the return value, its destructor may perform other calls */
+	if (info && info->func_name) {
+		profile_site = zephir_fcall_profile_site(info->func_name, info->func_length);
+	} else if (function_name && Z_TYPE_P(function_name) == IS_STRING) {
+		profile_site = zephir_fcall_profile_site(Z_STRVAL_P(function_name), Z_STRLEN_P(function_name));
+	} else {
+		profile_site = zephir_fcall_profile_site(NULL, 0);
+	}
+#endif
+
 	if (retval_ptr) {
 		zval_ptr_dtor(retval_ptr);
 		ZVAL_UNDEF(retval_ptr);
@@ -448,9 +721,24 @@ int zephir_call_user_function(zval *object_pp, zend_class_entry *obj_ce, zephir_
 #endif
 	}
 
+#ifdef ZEPHIR_FCALL_PROFILE
+	if ((cache_entry && *cache_entry) || !reload_cache) {
+		profile_path = ZEPHIR_FCALL_PROFILE_HIT;
+	} else if (fcic.function_handler) {
+		profile_path = ZEPHIR_FCALL_PROFILE_MISS;
+	} else {
+		profile_path = ZEPHIR_FCALL_PROFILE_SLOW;
+	}
+	profile_start = zephir_fcall_profile_time();
+#endif
+
 	/* fcic.initialized = 0; */
 	//status = ZEPHIR_ZEND_CALL_FUNCTION_WRAPPER(&fci, &fcic, info);
-	status = zephir_call_function_opt(&fci, &fcic, info, params);
+	status = zephir_call_function_opt(&fci, &fcic, info, params, param_moves);
+
+#ifdef ZEPHIR_FCALL_PROFILE
+	zephir_fcall_profile_record(profile_site, profile_path, (object_pp && type != zephir_fcall_ce ? Z_OBJCE_P(object_pp) : obj_ce), profile_start);
+#endif
 
 	EG(scope) = old_scope;
 
@@ -492,7 +780,7 @@ int zephir_call_user_function(zval *object_pp, zend_class_entry *obj_ce, zephir_
 
 int zephir_call_func_aparams(zval *return_value_ptr, const char *func_name, uint func_length,
 	zephir_fcall_cache_entry **cache_entry, int cache_slot,
-	uint param_count, zval **params)
+	uint param_count, zval **params, zend_uint param_moves)
 {
 	int status;
 	zval rv, *rvp = return_value_ptr ? return_value_ptr : &rv;
@@ -513,8 +801,9 @@ int zephir_call_func_aparams(zval *return_value_ptr, const char *func_name, uint
 	info.class_name = NULL;
 	info.func_name = func_name;
 	info.func_length = func_length;
+	info.func_str = NULL;
 
-	status = zephir_call_user_function(NULL, NULL, zephir_fcall_function, func, rvp, cache_entry, cache_slot, param_count, params, &info);
+	status = zephir_call_user_function(NULL, NULL, zephir_fcall_function, func, rvp, cache_entry, cache_slot, param_count, params, param_moves, &info);
 
 	if (status == FAILURE && !EG(exception)) {
 		zephir_throw_exception_format(spl_ce_RuntimeException, "Call to undefined function %s()", func_name);
@@ -541,7 +830,7 @@ int zephir_call_func_aparams(zval *return_value_ptr, const char *func_name, uint
 
 int zephir_call_zval_func_aparams(zval *return_value_ptr, zval *func_name,
 	zephir_fcall_cache_entry **cache_entry, int cache_slot,
-	uint param_count, zval **params)
+	uint param_count, zval **params, zend_uint param_moves)
 {
 	int status;
 	zval rv, *rvp = return_value_ptr ? return_value_ptr : &rv;
@@ -556,7 +845,7 @@ int zephir_call_zval_func_aparams(zval *return_value_ptr, zval *func_name,
 	}
 #endif
 
-	status = zephir_call_user_function(NULL, NULL, zephir_fcall_function, func_name, rvp, cache_entry, cache_slot, param_count, params, NULL);
+	status = zephir_call_user_function(NULL, NULL, zephir_fcall_function, func_name, rvp, cache_entry, cache_slot, param_count, params, param_moves, NULL);
 
 	if (status == FAILURE && !EG(exception)) {
 		zephir_throw_exception_format(spl_ce_RuntimeException, "Call to undefined function %s()", Z_TYPE_P(func_name) ? Z_STRVAL_P(func_name) : "undefined");
@@ -581,10 +870,10 @@ int zephir_call_zval_func_aparams(zval *return_value_ptr, zval *func_name,
 	return status;
 }
 
-int zephir_call_class_method_aparams(zval *return_value_ptr, zend_class_entry *ce, zephir_call_type type, zval *object,
-	const char *method_name, uint method_len,
+static int zephir_call_class_method_ex(zval *return_value_ptr, zend_class_entry *ce, zephir_call_type type, zval *object,
+	const char *method_name, uint method_len, zend_string *method_str,
 	zephir_fcall_cache_entry **cache_entry, int cache_slot,
-	uint param_count, zval **params)
+	uint param_count, zval **params, zend_uint param_moves)
 {
 	char *possible_method;
 	zval rv, *rvp = return_value_ptr ? return_value_ptr : &rv;
@@ -604,6 +893,7 @@ int zephir_call_class_method_aparams(zval *return_value_ptr, zend_class_entry *c
 
 	if (object) {
 		if (Z_TYPE_P(object) != IS_OBJECT) {
+			ZEPHIR_FCALL_PROFILE_CLEAR();
 			zephir_throw_exception_format(spl_ce_RuntimeException TSRMLS_CC, "Trying to call method %s on a non-object", method_name);
 			if (return_value_ptr) {
 				zval_ptr_dtor(return_value_ptr);
@@ -646,11 +936,13 @@ int zephir_call_class_method_aparams(zval *return_value_ptr, zend_class_entry *c
 				break;
 		}
 
-		info.func_name = method_name;
-		info.func_length = method_len;
 	}
 
-	status = zephir_call_user_function(object ? object : NULL, ce, type, fn, rvp, cache_entry, cache_slot, param_count, params, &info);
+	info.func_name = method_name;
+	info.func_length = method_len;
+	info.func_str = method_str;
+
+	status = zephir_call_user_function(object ? object : NULL, ce, type, fn, rvp, cache_entry, cache_slot, param_count, params, param_moves, &info);
 
 	if (status == FAILURE && !EG(exception)) {
 
@@ -720,6 +1012,240 @@ int zephir_call_class_method_aparams(zval *return_value_ptr, zend_class_entry *c
 	return status;
 }
 
+int zephir_call_class_method_aparams(zval *return_value_ptr, zend_class_entry *ce, zephir_call_type type, zval *object,
+	const char *method_name, uint method_len,
+	zephir_fcall_cache_entry **cache_entry, int cache_slot,
+	uint param_count, zval **params, zend_uint param_moves)
+{
+	return zephir_call_class_method_ex(return_value_ptr, ce, type, object, method_name, method_len, NULL, cache_entry, cache_slot, param_count, params, param_moves);
+}
+
+/**
+ * Calls a method using the interned lowercase method name created at MINIT,
+ * the name doesn't need to be lowercased and hashed when the call site cache misses
+ */
+int zephir_call_class_method_str_aparams(zval *return_value_ptr, zend_class_entry *ce, zephir_call_type type, zval *object,
+	zend_string *method,
+	zephir_fcall_cache_entry **cache_entry, int cache_slot,
+	uint param_count, zval **params, zend_uint param_moves)
+{
+	return zephir_call_class_method_ex(return_value_ptr, ce, type, object, ZSTR_VAL(method), ZSTR_LEN(method), method, cache_entry, cache_slot, param_count, params, param_moves);
+}
+
+/**
+ * Returns the callables cache of a call site, it is allocated the first time the site is reached in the request
+ */
+static zephir_callable_cache *zephir_callable_cache_get(int cache_slot)
+{
+	zend_zephir_globals_def *zephir_globals_ptr = ZEPHIR_VGLOBAL;
+
+	if (cache_slot <= 0 || cache_slot >= ZEPHIR_MAX_CALLABLE_SLOTS || !zephir_globals_ptr->cache_enabled) {
+		return NULL;
+	}
+
+	if (!zephir_globals_ptr->ccache[cache_slot]) {
+		zephir_globals_ptr->ccache[cache_slot] = ecalloc(1, sizeof(zephir_callable_cache));
+	}
+
+	return zephir_globals_ptr->ccache[cache_slot];
+}
+
+void zephir_callable_cache_destroy(void)
+{
+	zend_zephir_globals_def *zephir_globals_ptr = ZEPHIR_VGLOBAL;
+	int i;
+
+	for (i = 0; i < ZEPHIR_MAX_CALLABLE_SLOTS; i++) {
+		if (zephir_globals_ptr->ccache[i]) {
+			efree(zephir_globals_ptr->ccache[i]);
+			zephir_globals_ptr->ccache[i] = NULL;
+		}
+	}
+}
+
+/**
+ * Only [object, method] callables are cached, methods qualified with a scope are resolved every time
+ */
+static zend_always_inline int zephir_callable_cache_key(zval *handler, zval **object, zval **method)
+{
+	if (Z_TYPE_P(handler) != IS_ARRAY || zend_hash_num_elements(Z_ARRVAL_P(handler)) != 2) {
+		return 0;
+	}
+
+	*object = zend_hash_index_find(Z_ARRVAL_P(handler), 0);
+	*method = zend_hash_index_find(Z_ARRVAL_P(handler), 1);
+	if (!*object || !*method) {
+		return 0;
+	}
+
+	ZVAL_DEREF(*object);
+	ZVAL_DEREF(*method);
+
+	return Z_TYPE_P(*object) == IS_OBJECT
+		&& Z_TYPE_P(*method) == IS_STRING
+		&& Z_STRLEN_P(*method) < ZEPHIR_CALLABLE_CACHE_NAME
+		&& !memchr(Z_STRVAL_P(*method), ':', Z_STRLEN_P(*method));
+}
+
+static int zephir_callable_cache_find(zephir_callable_cache *cache, zval *handler, zend_fcall_info_cache *fcc)
+{
+	zval *object, *method;
+	zend_class_entry *ce;
+	zephir_callable_cache_entry *entry;
+	int i;
+
+	if (!zephir_callable_cache_key(handler, &object, &method)) {
+		return 0;
+	}
+
+	ce = Z_OBJCE_P(object);
+	for (i = 0; i < ZEPHIR_CALLABLE_CACHE_WAYS; i++) {
+		entry = &cache->entries[i];
+		if (entry->ce == ce && entry->scope == EG(scope) && entry->method_length == Z_STRLEN_P(method) && !memcmp(entry->method, Z_STRVAL_P(method), Z_STRLEN_P(method))) {
+			*fcc = entry->fcc;
+			fcc->object = Z_OBJ_P(object);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static void zephir_callable_cache_store(zephir_callable_cache *cache, zval *handler, const zend_fcall_info_cache *fcc)
+{
+	zval *object, *method;
+	zephir_callable_cache_entry *entry;
+
+	if (!fcc->function_handler || (fcc->function_handler->common.fn_flags & ZEND_ACC_CALL_VIA_TRAMPOLINE)) {
+		return;
+	}
+
+	if (!zephir_callable_cache_key(handler, &object, &method)) {
+		return;
+	}
+
+	entry = &cache->entries[cache->next];
+	cache->next = (cache->next + 1) % ZEPHIR_CALLABLE_CACHE_WAYS;
+
+	entry->ce = Z_OBJCE_P(object);
+	entry->scope = EG(scope);
+	entry->fcc = *fcc;
+	entry->fcc.object = NULL;
+	entry->method_length = Z_STRLEN_P(method);
+	memcpy(entry->method, Z_STRVAL_P(method), Z_STRLEN_P(method));
+}
+
+/**
+ * Closures carry their own function, so they are resolved directly from the object
+ */
+static zend_always_inline int zephir_callable_closure(zval *handler, zend_fcall_info_cache *fcc)
+{
+	if (Z_TYPE_P(handler) != IS_OBJECT || Z_OBJCE_P(handler) != zend_ce_closure) {
+		return 0;
+	}
+
+	if (Z_OBJ_HANDLER_P(handler, get_closure)(handler, &fcc->calling_scope, &fcc->function_handler, &fcc->object) == FAILURE) {
+		return 0;
+	}
+
+	fcc->called_scope = fcc->calling_scope;
+	fcc->initialized = 1;
+	return 1;
+}
+
+/**
+ * Replaces call_user_func_array avoiding function lookup
+ * This function does not return FAILURE if an exception has ocurred
+ */
+int zephir_call_user_func_array_noex(zval *return_value, zval *handler, zval *params, int cache_slot)
+{
+	zend_fcall_info fci;
+	zend_fcall_info_cache fcc;
+	zephir_callable_cache *cache = NULL;
+	char *is_callable_error = NULL;
+	zval args_local[8], *args = args_local, *arg;
+	zval *params_local[8], **params_ptr = params_local;
+	uint32_t i = 0, param_count = 0;
+	int status;
+
+	if (params && Z_TYPE_P(params) != IS_ARRAY) {
+		ZVAL_NULL(return_value);
+		php_error_docref(NULL, E_WARNING, "Invalid arguments supplied for zephir_call_user_func_array_noex()");
+		return FAILURE;
+	}
+
+	fcc.initialized = 0;
+	if (!zephir_callable_closure(handler, &fcc)) {
+		cache = zephir_callable_cache_get(cache_slot);
+		if (!cache || !zephir_callable_cache_find(cache, handler, &fcc)) {
+			if (!zend_is_callable_ex(handler, NULL, 0, NULL, &fcc, &is_callable_error)) {
+				if (is_callable_error) {
+					zend_error(E_WARNING, "%s", is_callable_error);
+					efree(is_callable_error);
+				}
+				ZVAL_NULL(return_value);
+				return EG(exception) ? SUCCESS : FAILURE;
+			}
+
+			if (is_callable_error) {
+				zend_error(E_STRICT, "%s", is_callable_error);
+				efree(is_callable_error);
+			}
+
+			if (cache) {
+				zephir_callable_cache_store(cache, handler, &fcc);
+			}
+		}
+		fcc.initialized = 1;
+	}
+
+	if (params) {
+		param_count = zend_hash_num_elements(Z_ARRVAL_P(params));
+	}
+
+	if (param_count > sizeof(args_local) / sizeof(zval)) {
+		args = safe_emalloc(param_count, sizeof(zval), 0);
+		params_ptr = safe_emalloc(param_count, sizeof(zval *), 0);
+	}
+
+	if (param_count) {
+		ZEND_HASH_FOREACH_VAL(Z_ARRVAL_P(params), arg) {
+			ZVAL_COPY(&args[i], arg);
+			params_ptr[i] = &args[i];
+			i++;
+		} ZEND_HASH_FOREACH_END();
+	}
+
+	fci.size = sizeof(fci);
+	fci.function_table = NULL;
+	ZVAL_COPY_VALUE(&fci.function_name, handler);
+	fci.symbol_table = NULL;
+	fci.object = fcc.object;
+	fci.retval = return_value;
+	fci.param_count = param_count;
+	fci.params = NULL;
+	fci.no_separation = 1;
+
+	status = zephir_call_function_opt(&fci, &fcc, NULL, params_ptr, 0);
+	if (Z_TYPE_P(return_value) == IS_UNDEF) {
+		ZVAL_NULL(return_value);
+	}
+
+	for (i = 0; i < param_count; i++) {
+		zval_ptr_dtor(&args[i]);
+	}
+
+	if (args != args_local) {
+		efree(args);
+		efree(params_ptr);
+	}
+
+	if (EG(exception)) {
+		status = SUCCESS;
+	}
+
+	return status;
+}
 
 /**
  * If a retval_ptr is specified, PHP's implementation of zend_eval_stringl
@@ -39,6 +39,61 @@ typedef enum _zephir_call_type {
 	zephir_fcall_function
 } zephir_call_type;
 
+/* The call sites table isn't synchronized, profiling is only available in non-ZTS builds */
+#if defined(ZEPHIR_FCALL_PROFILE) && defined(ZTS)
+#undef ZEPHIR_FCALL_PROFILE
+#endif
+
+#ifdef ZEPHIR_FCALL_PROFILE
+/**
+ * Call sites are identified by the generated file and line that performs the call,
+ * every path of the callee must consume the mark or clear it. The mark is set right
+ * before the call, after the return variable is released, so destructors run by that
+ * release can't take it. A mark still set when the next one is made was never consumed,
+ * it is counted as stale
+ */
+extern const char *zephir_fcall_profile_file;
+extern int zephir_fcall_profile_line;
+extern unsigned long zephir_fcall_profile_stale;
+
+#define ZEPHIR_FCALL_PROFILE_SITE() \
+	do { \
+		if (UNEXPECTED(zephir_fcall_profile_file != NULL)) { \
+			zephir_fcall_profile_stale++; \
+		} \
+		zephir_fcall_profile_file = __FILE__; \
+		zephir_fcall_profile_line = __LINE__; \
+	} while (0)
+
+/* Calls returning into return_value release it first, the wrappers release it again as a no-op */
+#define ZEPHIR_FCALL_PROFILE_RETURN_SITE() \
+	do { \
+		if (return_value) { \
+			zval_ptr_dtor(return_value); \
+			ZVAL_UNDEF(return_value); \
+		} \
+		ZEPHIR_FCALL_PROFILE_SITE(); \
+	} while (0)
+
+#define ZEPHIR_FCALL_PROFILE_CLEAR() zephir_fcall_profile_file = NULL
+
+#define ZEPHIR_FCALL_PROFILE_HIT 0
+#define ZEPHIR_FCALL_PROFILE_MISS 1
+#define ZEPHIR_FCALL_PROFILE_SLOW 2
+
+typedef struct _zephir_fcall_site zephir_fcall_site;
+
+zephir_fcall_site *zephir_fcall_profile_site(const char *name, size_t name_length);
+void zephir_fcall_profile_record(zephir_fcall_site *site, int path, const zend_class_entry *ce, double start);
+double zephir_fcall_profile_time(void);
+void zephir_fcall_profile_dump(FILE *stream, int json);
+void zephir_fcall_profile_shutdown(void);
+#else
+#define ZEPHIR_FCALL_PROFILE_SITE()
+#define ZEPHIR_FCALL_PROFILE_RETURN_SITE()
+#define ZEPHIR_FCALL_PROFILE_CLEAR()
+#endif
+
 /**
  * @addtogroup callfuncs Calling Functions
  * @{
@@ -56,24 +111,41 @@ typedef enum _zephir_call_type {
 #define ZEPHIR_CALL_FUNCTION(return_value_ptr, func_name, cache, cache_slot, ...) \
 	do { \
 		zephir_fcall_cache_entry **cache_entry_ = cache; \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
 		ZEPHIR_OBSERVE_OR_NULLIFY_PPZV(return_value_ptr); \
+		ZEPHIR_FCALL_PROFILE_SITE(); \
 		if (__builtin_constant_p(func_name)) { \
 			if (cache_entry_ && *cache_entry_) { \
-				ZEPHIR_LAST_CALL_STATUS = zephir_call_func_aparams_fast(return_value_ptr, cache, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+				ZEPHIR_LAST_CALL_STATUS = zephir_call_func_aparams_fast(return_value_ptr, cache, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 			} else { \
-				ZEPHIR_LAST_CALL_STATUS = zephir_call_func_aparams(return_value_ptr, func_name, sizeof(func_name)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+				ZEPHIR_LAST_CALL_STATUS = zephir_call_func_aparams(return_value_ptr, func_name, sizeof(func_name)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 			} \
 		} else { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_call_func_aparams(return_value_ptr, func_name, strlen(func_name), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_call_func_aparams(return_value_ptr, func_name, strlen(func_name), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 	} while (0)
 
+/**
+ * Calls a function implemented in C invoking its handler directly,
+ * the compiler only emits it for functions without parameters passed by reference
+ */
+#define ZEPHIR_CALL_INTERNAL_FUNCTION(return_value_ptr, func_name, func_slot, ...) \
+	do { \
+		zend_uint moves_ = 0; \
+		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
+		ZEPHIR_OBSERVE_OR_NULLIFY_PPZV(return_value_ptr); \
+		ZEPHIR_FCALL_PROFILE_SITE(); \
+		ZEPHIR_LAST_CALL_STATUS = zephir_call_internal_func_aparams(return_value_ptr, func_name, sizeof(func_name)-1, func_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
+	} while (0)
+
 #define ZEPHIR_CALL_ZVAL_FUNCTION(return_value_ptr, func_name, cache, cache_slot, ...) \
 	do { \
+        	zend_uint moves_ = 0; \
         	zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
         	ZEPHIR_OBSERVE_OR_NULLIFY_PPZV(return_value_ptr); \
-        	ZEPHIR_LAST_CALL_STATUS = zephir_call_zval_func_aparams(return_value_ptr, func_name, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+        	ZEPHIR_FCALL_PROFILE_SITE(); \
+        	ZEPHIR_LAST_CALL_STATUS = zephir_call_zval_func_aparams(return_value_ptr, func_name, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 	} while (0)
 
 /* Saves the if pointer, and called/calling scope */
@@ -115,37 +187,73 @@ typedef enum _zephir_call_type {
 
 #define ZEPHIR_RETURN_CALL_ZVAL_FUNCTION(func_name, cache, cache_slot, ...) \
 	do { \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
-		ZEPHIR_LAST_CALL_STATUS = zephir_return_call_zval_function(return_value, func_name, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+		ZEPHIR_FCALL_PROFILE_RETURN_SITE(); \
+		ZEPHIR_LAST_CALL_STATUS = zephir_return_call_zval_function(return_value, func_name, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 	} while (0)
 
 #define ZEPHIR_RETURN_CALL_FUNCTION(func_name, cache, cache_slot, ...) \
 	do { \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
+		ZEPHIR_FCALL_PROFILE_RETURN_SITE(); \
 		if (__builtin_constant_p(func_name)) { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_function(return_value, func_name, sizeof(func_name)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_function(return_value, func_name, sizeof(func_name)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 		else { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_function(return_value, func_name, strlen(func_name), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_function(return_value, func_name, strlen(func_name), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 	} while (0)
 
+#define ZEPHIR_RETURN_CALL_INTERNAL_FUNCTION(func_name, func_slot, ...) \
+	do { \
+		zend_uint moves_ = 0; \
+		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
+		ZEPHIR_FCALL_PROFILE_RETURN_SITE(); \
+		ZEPHIR_LAST_CALL_STATUS = zephir_return_call_internal_function(return_value, func_name, sizeof(func_name)-1, func_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
+	} while (0)
+
 #define ZEPHIR_CALL_METHOD(return_value_ptr, object, method, cache, cache_slot, ...) \
 	do { \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
 		ZEPHIR_OBSERVE_OR_NULLIFY_PPZV(return_value_ptr); \
+		ZEPHIR_FCALL_PROFILE_SITE(); \
 		if (__builtin_constant_p(method)) { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, Z_TYPE_P(object) == IS_OBJECT ? Z_OBJCE_P(object) : NULL, zephir_fcall_method, object, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, Z_TYPE_P(object) == IS_OBJECT ? Z_OBJCE_P(object) : NULL, zephir_fcall_method, object, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} else { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, Z_TYPE_P(object) == IS_OBJECT ? Z_OBJCE_P(object) : NULL, zephir_fcall_method, object, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, Z_TYPE_P(object) == IS_OBJECT ? Z_OBJCE_P(object) : NULL, zephir_fcall_method, object, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 	} while (0)
 
+/**
+ * Calls a method using the interned lowercase method name created at MINIT
+ */
+#define ZEPHIR_CALL_METHOD_STR(return_value_ptr, object, method, cache, cache_slot, ...) \
+	do { \
+		zend_uint moves_ = 0; \
+		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
+		ZEPHIR_OBSERVE_OR_NULLIFY_PPZV(return_value_ptr); \
+		ZEPHIR_FCALL_PROFILE_SITE(); \
+		ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_str_aparams(return_value_ptr, Z_TYPE_P(object) == IS_OBJECT ? Z_OBJCE_P(object) : NULL, zephir_fcall_method, object, method, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
+	} while (0)
+
+#define ZEPHIR_RETURN_CALL_METHOD_STR(object, method, cache, cache_slot, ...) \
+	do { \
+		zend_uint moves_ = 0; \
+		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
+		ZEPHIR_FCALL_PROFILE_RETURN_SITE(); \
+		ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method_str(return_value, Z_TYPE_P(object) == IS_OBJECT ? Z_OBJCE_P(object) : NULL, zephir_fcall_method, object, method, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
+	} while (0)
+
 #define ZEPHIR_RETURN_CALL_METHOD_ZVAL(object, method, cache, cache_slot, ...) \
 	do { \
 		char *method_name; \
 		int method_len; \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
+		ZEPHIR_FCALL_PROFILE_RETURN_SITE(); \
 		if (Z_TYPE_P(method) == IS_STRING) { \
 			method_len = Z_STRLEN_P(method); \
 			method_name = zend_str_tolower_dup(Z_STRVAL_P(method), method_len); \
@@ -153,7 +261,7 @@ typedef enum _zephir_call_type {
 			method_len = 0; \
 			method_name = zend_str_tolower_dup("", 0); \
 		} \
-		ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, Z_TYPE_P(object) == IS_OBJECT ? Z_OBJCE_P(object) : NULL, zephir_fcall_method, object, method_name, method_len, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+		ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, Z_TYPE_P(object) == IS_OBJECT ? Z_OBJCE_P(object) : NULL, zephir_fcall_method, object, method_name, method_len, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		efree(method_name); \
 	} while (0)
 
@@ -161,6 +269,7 @@ typedef enum _zephir_call_type {
 	do { \
 		char *method_name; \
 		int method_len; \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
 		if (Z_TYPE_P(method) == IS_STRING) { \
 			method_len = Z_STRLEN_P(method); \
@@ -170,120 +279,141 @@ typedef enum _zephir_call_type {
 			method_name = zend_str_tolower_dup("", 0); \
 		} \
 		ZEPHIR_OBSERVE_OR_NULLIFY_PPZV(return_value_ptr); \
-		ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, Z_TYPE_P(object) == IS_OBJECT ? Z_OBJCE_P(object) : NULL, zephir_fcall_method, object, method_name, method_len, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+		ZEPHIR_FCALL_PROFILE_SITE(); \
+		ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, Z_TYPE_P(object) == IS_OBJECT ? Z_OBJCE_P(object) : NULL, zephir_fcall_method, object, method_name, method_len, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		efree(method_name); \
 	} while (0)
 
 #define ZEPHIR_CALL_PARENT(return_value_ptr, class_entry, this_ptr, method, cache, cache_slot, ...) \
 	do { \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
 		ZEPHIR_OBSERVE_OR_NULLIFY_PPZV(return_value_ptr); \
+		ZEPHIR_FCALL_PROFILE_SITE(); \
 		if (__builtin_constant_p(method)) { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, class_entry, zephir_fcall_parent, this_ptr, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, class_entry, zephir_fcall_parent, this_ptr, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 		else { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, class_entry, zephir_fcall_parent, this_ptr, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, class_entry, zephir_fcall_parent, this_ptr, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 	} while (0)
 
 #define ZEPHIR_RETURN_CALL_METHOD(object, method, cache, cache_slot, ...) \
 	do { \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
+		ZEPHIR_FCALL_PROFILE_RETURN_SITE(); \
 		if (__builtin_constant_p(method)) { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, Z_TYPE_P(object) == IS_OBJECT ? Z_OBJCE_P(object) : NULL, zephir_fcall_method, object, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, Z_TYPE_P(object) == IS_OBJECT ? Z_OBJCE_P(object) : NULL, zephir_fcall_method, object, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} else { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, Z_TYPE_P(object) == IS_OBJECT ? Z_OBJCE_P(object) : NULL, zephir_fcall_method, object, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, Z_TYPE_P(object) == IS_OBJECT ? Z_OBJCE_P(object) : NULL, zephir_fcall_method, object, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 	} while (0)
 
 #define ZEPHIR_RETURN_CALL_STATIC(method, cache, cache_slot, ...) \
 	do { \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
+		ZEPHIR_FCALL_PROFILE_RETURN_SITE(); \
 		if (__builtin_constant_p(method)) { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, NULL, zephir_fcall_static, NULL, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, NULL, zephir_fcall_static, NULL, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 		else { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, NULL, zephir_fcall_static, NULL, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, NULL, zephir_fcall_static, NULL, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 	} while (0)
 
 #define ZEPHIR_RETURN_CALL_PARENT(class_entry, this_ptr, method, cache, cache_slot, ...) \
 	do { \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
+		ZEPHIR_FCALL_PROFILE_RETURN_SITE(); \
 		if (__builtin_constant_p(method)) { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, class_entry, zephir_fcall_parent, this_ptr, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, class_entry, zephir_fcall_parent, this_ptr, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 		else { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, class_entry, zephir_fcall_parent, this_ptr, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, class_entry, zephir_fcall_parent, this_ptr, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 	} while (0)
 
 #define ZEPHIR_CALL_SELF(return_value_ptr, method, cache, cache_slot, ...) \
 	do { \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
 		ZEPHIR_OBSERVE_OR_NULLIFY_PPZV(return_value_ptr); \
+		ZEPHIR_FCALL_PROFILE_SITE(); \
 		if (__builtin_constant_p(method)) { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, NULL, zephir_fcall_self, NULL, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, NULL, zephir_fcall_self, NULL, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 		else { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, NULL, zephir_fcall_self, NULL, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, NULL, zephir_fcall_self, NULL, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 	} while (0)
 
 #define ZEPHIR_RETURN_CALL_SELF(method, cache, cache_slot, ...) \
 	do { \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
+		ZEPHIR_FCALL_PROFILE_RETURN_SITE(); \
 		if (__builtin_constant_p(method)) { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, NULL, zephir_fcall_self, NULL, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, NULL, zephir_fcall_self, NULL, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 		else { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, NULL, zephir_fcall_self, NULL, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, NULL, zephir_fcall_self, NULL, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 	} while (0)
 
 #define ZEPHIR_CALL_STATIC(return_value_ptr, method, cache, cache_slot, ...) \
 	do { \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
 		ZEPHIR_OBSERVE_OR_NULLIFY_PPZV(return_value_ptr); \
+		ZEPHIR_FCALL_PROFILE_SITE(); \
 		if (__builtin_constant_p(method)) { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, NULL, zephir_fcall_static, NULL, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, NULL, zephir_fcall_static, NULL, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 		else { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, NULL, zephir_fcall_static, NULL, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, NULL, zephir_fcall_static, NULL, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 	} while (0)
 
 #define ZEPHIR_CALL_CE_STATIC(return_value_ptr, class_entry, method, cache, cache_slot, ...) \
 	do { \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
 		ZEPHIR_OBSERVE_OR_NULLIFY_PPZV(return_value_ptr); \
+		ZEPHIR_FCALL_PROFILE_SITE(); \
 		if (__builtin_constant_p(method)) { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, class_entry, zephir_fcall_ce, NULL, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, class_entry, zephir_fcall_ce, NULL, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 		else { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, class_entry, zephir_fcall_ce, NULL, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_call_class_method_aparams(return_value_ptr, class_entry, zephir_fcall_ce, NULL, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 	} while (0)
 
 #define ZEPHIR_RETURN_CALL_CE_STATIC(class_entry, method, cache, cache_slot, ...) \
 	do { \
+		zend_uint moves_ = 0; \
 		zval *params_[] = {ZEPHIR_FETCH_VA_ARGS __VA_ARGS__}; \
+		ZEPHIR_FCALL_PROFILE_RETURN_SITE(); \
 		if (__builtin_constant_p(method)) { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, class_entry, zephir_fcall_ce, NULL, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, class_entry, zephir_fcall_ce, NULL, method, sizeof(method)-1, cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 		else { \
-			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, class_entry, zephir_fcall_ce, NULL, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_)); \
+			ZEPHIR_LAST_CALL_STATUS = zephir_return_call_class_method(return_value, class_entry, zephir_fcall_ce, NULL, method, strlen(method), cache, cache_slot, ZEPHIR_CALL_NUM_PARAMS(params_), ZEPHIR_PASS_CALL_PARAMS(params_), moves_); \
 		} \
 	} while (0)
 
 int zephir_call_func_aparams(zval *return_value_ptr, const char *func_name, uint func_length,
 	zephir_fcall_cache_entry **cache_entry, int cache_slot,
-	uint param_count, zval **params);
-int zephir_call_func_aparams_fast(zval *return_value_ptr, zephir_fcall_cache_entry **cache_entry, uint param_count, zval **params);
+	uint param_count, zval **params, zend_uint param_moves);
+int zephir_call_func_aparams_fast(zval *return_value_ptr, zephir_fcall_cache_entry **cache_entry, uint param_count, zval **params, zend_uint param_moves);
+int zephir_call_internal_func_aparams(zval *return_value_ptr, const char *func_name, uint func_length,
+	int func_slot, uint param_count, zval **params, zend_uint param_moves) ZEPHIR_ATTR_WARN_UNUSED_RESULT;
 
 int zephir_call_zval_func_aparams(zval *return_value_ptr, zval *func_name,
 	zephir_fcall_cache_entry **cache_entry, int cache_slot,
-	uint param_count, zval **params) ZEPHIR_ATTR_WARN_UNUSED_RESULT;
+	uint param_count, zval **params, zend_uint param_moves) ZEPHIR_ATTR_WARN_UNUSED_RESULT;
 
 int zephir_call_class_method_aparams(zval *return_value_ptr,
 	zend_class_entry *ce,
@@ -294,10 +424,50 @@ int zephir_call_class_method_aparams(zval *return_value_ptr,
 	zephir_fcall_cache_entry **cache_entry,
 	int cache_slot,
 	uint param_count,
-	zval **params) ZEPHIR_ATTR_WARN_UNUSED_RESULT;
+	zval **params,
+	zend_uint param_moves) ZEPHIR_ATTR_WARN_UNUSED_RESULT;
+
+int zephir_call_class_method_str_aparams(zval *return_value_ptr,
+	zend_class_entry *ce,
+	zephir_call_type type,
+	zval *object,
+	zend_string *method,
+	zephir_fcall_cache_entry **cache_entry,
+	int cache_slot,
+	uint param_count,
+	zval **params,
+	zend_uint param_moves) ZEPHIR_ATTR_WARN_UNUSED_RESULT;
 
 ZEPHIR_ATTR_WARN_UNUSED_RESULT static inline int zephir_return_call_function(zval *return_value,
-	const char *func, uint func_len, zephir_fcall_cache_entry **cache_entry, int cache_slot, uint param_count, zval **params)
+	const char *func, uint func_len, zephir_fcall_cache_entry **cache_entry, int cache_slot, uint param_count, zval **params, zend_uint param_moves)
+{
+	zval rv, *rvp = return_value ? return_value : &rv;
+	int status;
+
+	if (return_value) {
+		zval_ptr_dtor(return_value);
+		ZVAL_UNDEF(return_value);
+	}
+
+	status = zephir_call_func_aparams(rvp, func, func_len, cache_entry, cache_slot, param_count, params, param_moves);
+
+	if (status == FAILURE) {
+		if (return_value && EG(exception)) {
+			ZVAL_NULL(return_value);
+		}
+
+		return FAILURE;
+	}
+
+	if (!return_value) {
+		zval_ptr_dtor(&rv);
+	}
+
+	return SUCCESS;
+}
+
+ZEPHIR_ATTR_WARN_UNUSED_RESULT static inline int zephir_return_call_internal_function(zval *return_value,
+	const char *func, uint func_len, int func_slot, uint param_count, zval **params, zend_uint param_moves)
 {
 	zval rv, *rvp = return_value ? return_value : &rv;
 	int status;
@@ -307,7 +477,7 @@ ZEPHIR_ATTR_WARN_UNUSED_RESULT static inline int zephir_return_call_function(zva
 		ZVAL_UNDEF(return_value);
 	}
 
-	status = zephir_call_func_aparams(rvp, func, func_len, cache_entry, cache_slot, param_count, params);
+	status = zephir_call_internal_func_aparams(rvp, func, func_len, func_slot, param_count, params, param_moves);
 
 	if (status == FAILURE) {
 		if (return_value && EG(exception)) {
@@ -325,7 +495,7 @@ ZEPHIR_ATTR_WARN_UNUSED_RESULT static inline int zephir_return_call_function(zva
 }
 
 ZEPHIR_ATTR_WARN_UNUSED_RESULT static inline int zephir_return_call_zval_function(zval *return_value,
-	zval *func, zephir_fcall_cache_entry **cache_entry, int cache_slot, uint param_count, zval **params)
+	zval *func, zephir_fcall_cache_entry **cache_entry, int cache_slot, uint param_count, zval **params, zend_uint param_moves)
 {
 	zval rv, *rvp = return_value ? return_value : &rv;
 	int status;
@@ -335,7 +505,7 @@ ZEPHIR_ATTR_WARN_UNUSED_RESULT static inline int zephir_return_call_zval_functio
 		ZVAL_UNDEF(return_value);
 	}
 
-	status = zephir_call_zval_func_aparams(rvp, func, cache_entry, cache_slot, param_count, params);
+	status = zephir_call_zval_func_aparams(rvp, func, cache_entry, cache_slot, param_count, params, param_moves);
 
 	if (status == FAILURE) {
 		if (return_value && EG(exception)) {
@@ -356,7 +526,39 @@ ZEPHIR_ATTR_WARN_UNUSED_RESULT static inline int zephir_return_call_class_method
 	zend_class_entry *ce, zephir_call_type type, zval *object,
 	const char *method_name, uint method_len,
 	zephir_fcall_cache_entry **cache_entry, int cache_slot,
-	uint param_count, zval **params)
+	uint param_count, zval **params, zend_uint param_moves)
+{
+	zval rv, *rvp = return_value ? return_value : &rv;
+	int status;
+
+	ZVAL_UNDEF(&rv);
+
+	if (return_value) {
+		zval_ptr_dtor(return_value);
+		ZVAL_UNDEF(return_value);
+	}
+
+	status = zephir_call_class_method_aparams(rvp, ce, type, object, method_name, method_len, cache_entry, cache_slot, param_count, params, param_moves);
+
+	if (status == FAILURE) {
+		if (return_value && EG(exception)) {
+			ZVAL_NULL(return_value);
+		}
+
+		return FAILURE;
+	}
+
+	if (!return_value) {
+		zval_ptr_dtor(&rv);
+	}
+
+	return SUCCESS;
+}
+
+ZEPHIR_ATTR_WARN_UNUSED_RESULT static inline int zephir_return_call_class_method_str(zval *return_value,
+	zend_class_entry *ce, zephir_call_type type, zval *object, zend_string *method,
+	zephir_fcall_cache_entry **cache_entry, int cache_slot,
+	uint param_count, zval **params, zend_uint param_moves)
 {
 	zval rv, *rvp = return_value ? return_value : &rv;
 	int status;
@@ -368,7 +570,7 @@ ZEPHIR_ATTR_WARN_UNUSED_RESULT static inline int zephir_return_call_class_method
 		ZVAL_UNDEF(return_value);
 	}
 
-	status = zephir_call_class_method_aparams(rvp, ce, type, object, method_name, method_len, cache_entry, cache_slot, param_count, params);
+	status = zephir_call_class_method_str_aparams(rvp, ce, type, object, method, cache_entry, cache_slot, param_count, params, param_moves);
 
 	if (status == FAILURE) {
 		if (return_value && EG(exception)) {
@@ -385,6 +587,31 @@ ZEPHIR_ATTR_WARN_UNUSED_RESULT static inline int zephir_return_call_class_method
 	return SUCCESS;
 }
 
+/** Use these functions to call functions in the PHP userland using an arbitrary zval as callable */
+#define ZEPHIR_CALL_USER_FUNC(return_value, handler, cache_slot) ZEPHIR_CALL_USER_FUNC_ARRAY(return_value, handler, NULL, cache_slot)
+#define ZEPHIR_CALL_USER_FUNC_ARRAY(return_value, handler, params, cache_slot) \
+	do { \
+		ZEPHIR_LAST_CALL_STATUS = zephir_call_user_func_array(return_value, handler, params, cache_slot); \
+	} while (0)
+
+#define ZEPHIR_CALL_USER_FUNC_ARRAY_NOEX(return_value, handler, params, cache_slot) \
+	do { \
+		ZEPHIR_LAST_CALL_STATUS = zephir_call_user_func_array_noex(return_value, handler, params, cache_slot); \
+	} while (0)
+
+/** Fast call_user_func_array/call_user_func */
+int zephir_call_user_func_array_noex(zval *return_value, zval *handler, zval *params, int cache_slot) ZEPHIR_ATTR_WARN_UNUSED_RESULT;
+void zephir_callable_cache_destroy(void);
+
+/**
+ * Replaces call_user_func_array avoiding function lookup
+ */
+ZEPHIR_ATTR_WARN_UNUSED_RESULT static inline int zephir_call_user_func_array(zval *return_value, zval *handler, zval *params, int cache_slot)
+{
+	int status = zephir_call_user_func_array_noex(return_value, handler, params, cache_slot);
+	return (EG(exception)) ? FAILURE : status;
+}
+
 int zephir_has_constructor_ce(const zend_class_entry *ce) ZEPHIR_ATTR_PURE ZEPHIR_ATTR_NONNULL;
 
 ZEPHIR_ATTR_WARN_UNUSED_RESULT ZEPHIR_ATTR_NONNULL static inline int zephir_has_constructor(const zval *object)
@@ -410,6 +637,13 @@ ZEPHIR_ATTR_WARN_UNUSED_RESULT ZEPHIR_ATTR_NONNULL static inline int zephir_has_
 		} \
 	}
 
+/**
+ * Temporary parameters owned by the call site are handed over to the callee frame instead of being copied,
+ * their positions are collected in the bitmask the call macros pass along with the parameters vector
+ */
+#define ZEPHIR_MOVE_PARAM(param, position) (moves_ |= (1U << (position)), (param))
+#define ZEPHIR_PARAM_IS_MOVED(moves, position) ((position) < 32 && ((moves) & (1U << (position))))
+
 #ifdef ZEPHIR_RELEASE
 #define ZEPHIR_TEMP_PARAM_COPY 0
 #define zephir_check_temp_parameter(param) do { if (Z_REFCOUNT(param) > 1) zval_copy_ctor(&param); else ZVAL_NULL(&param); } while(0)
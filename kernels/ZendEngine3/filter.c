@@ -32,7 +32,392 @@
 
 #include "kernel/main.h"
 #include "kernel/memory.h"
+#include "kernel/filter.h"
 
 #include "Zend/zend_exceptions.h"
 #include "Zend/zend_interfaces.h"
+#include "Zend/zend_smart_str.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define ZEPHIR_FILTER_ALNUM      1
+#define ZEPHIR_FILTER_IDENTIFIER 2
+#define ZEPHIR_FILTER_WHITELIST  4
+
+/**
+ * Classes of every byte: alphanumeric, identifier (alphanumeric and '_') and the characters
+ * left as they are by the javascript/html attribute escapers (alphanumeric and the whitelist)
+ */
+static const unsigned char zephir_filter_class[256] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	4, 4, 0, 4, 4, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 4, 4, 0, 0, 0, 4,
+	0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 4, 4, 4, 4, 6,
+	0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 4, 4, 4, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+/**
+ * The same classes as ranges of bytes [from, from + count)
+ */
+static const unsigned char zephir_filter_alnum_ranges[][2] = {
+	{ '0', 10 }, { 'A', 26 }, { 'a', 26 }
+};
+
+static const unsigned char zephir_filter_identifier_ranges[][2] = {
+	{ '0', 10 }, { 'A', 26 }, { '_', 1 }, { 'a', 26 }
+};
+
+static const unsigned char zephir_filter_whitelist_ranges[][2] = {
+	{ '\t', 2 }, { ' ', 2 }, { '#', 2 }, { '(', 20 }, { '?', 1 }, { 'A', 31 }, { 'a', 29 }
+};
+
+/**
+ * Returns the length of the prefix of str made of bytes of the given class, 16 bytes are
+ * checked at once by testing every range of the class on the whole block
+ */
+static size_t zephir_filter_span(const unsigned char *str, size_t length, int filter_class)
+{
+	size_t i = 0;
+
+#ifdef __SSE2__
+	const unsigned char (*ranges)[2];
+	size_t count, r;
+	__m128i block, accepted;
+	int mask;
+
+	switch (filter_class) {
+		case ZEPHIR_FILTER_ALNUM:
+			ranges = zephir_filter_alnum_ranges;
+			count = sizeof(zephir_filter_alnum_ranges) / sizeof(zephir_filter_alnum_ranges[0]);
+			break;
+		case ZEPHIR_FILTER_IDENTIFIER:
+			ranges = zephir_filter_identifier_ranges;
+			count = sizeof(zephir_filter_identifier_ranges) / sizeof(zephir_filter_identifier_ranges[0]);
+			break;
+		default:
+			ranges = zephir_filter_whitelist_ranges;
+			count = sizeof(zephir_filter_whitelist_ranges) / sizeof(zephir_filter_whitelist_ranges[0]);
+			break;
+	}
+
+	for (; i + 16 <= length; i += 16) {
+		block = _mm_loadu_si128((const __m128i *) (str + i));
+		accepted = _mm_setzero_si128();
+		for (r = 0; r < count; r++) {
+			/* moves [from, from + count) to the bottom of the signed range so one compare checks it */
+			accepted = _mm_or_si128(accepted, _mm_cmplt_epi8(
+				_mm_add_epi8(block, _mm_set1_epi8((char) (128 - ranges[r][0]))),
+				_mm_set1_epi8((char) (-128 + ranges[r][1]))
+			));
+		}
+		mask = _mm_movemask_epi8(accepted);
+		if (mask != 0xFFFF) {
+			return i + __builtin_ctz(~mask);
+		}
+	}
+#endif
+
+	while (i < length && (zephir_filter_class[str[i]] & filter_class)) {
+		i++;
+	}
+
+	return i;
+}
+
+/**
+ * Keeps only the bytes of the given class, the string is cut at the first NUL byte
+ */
+static void zephir_filter_class_only(zval *return_value, zval *param, int filter_class)
+{
+	const unsigned char *str, *end;
+	size_t length, prefix, i;
+	zend_string *filtered;
+	unsigned char *dest;
+	zval copy;
+	int use_copy = 0;
+
+	if (Z_TYPE_P(param) != IS_STRING) {
+		use_copy = zend_make_printable_zval(param, &copy);
+		if (use_copy) {
+			param = &copy;
+		}
+	}
+
+	str = (const unsigned char *) Z_STRVAL_P(param);
+	end = memchr(str, '\0', Z_STRLEN_P(param));
+	length = end ? (size_t) (end - str) : Z_STRLEN_P(param);
+
+	prefix = zephir_filter_span(str, length, filter_class);
+	if (prefix == Z_STRLEN_P(param)) {
+		RETVAL_STR_COPY(Z_STR_P(param));
+	} else {
+		filtered = zend_string_alloc(length, 0);
+		dest = (unsigned char *) ZSTR_VAL(filtered);
+
+		memcpy(dest, str, prefix);
+		dest += prefix;
+		for (i = prefix; i < length; i++) {
+			if (zephir_filter_class[str[i]] & filter_class) {
+				*dest++ = str[i];
+			}
+		}
+		*dest = '\0';
+		ZSTR_LEN(filtered) = dest - (unsigned char *) ZSTR_VAL(filtered);
+
+		RETVAL_NEW_STR(filtered);
+	}
+
+	if (use_copy) {
+		zval_dtor(param);
+	}
+}
+
+/**
+ * Filter alphanum string
+ */
+void zephir_filter_alphanum(zval *return_value, zval *param)
+{
+	zephir_filter_class_only(return_value, param, ZEPHIR_FILTER_ALNUM);
+}
+
+/**
+ * Filter identifiers string like variables or database columns/tables
+ */
+void zephir_filter_identifier(zval *return_value, zval *param)
+{
+	zephir_filter_class_only(return_value, param, ZEPHIR_FILTER_IDENTIFIER);
+}
+
+/**
+ * Check if a string is encoded with ASCII or ISO-8859-1
+ */
+void zephir_is_basic_charset(zval *return_value, const zval *param)
+{
+	unsigned int i;
+	unsigned int ch;
+	int iso88591 = 0;
+
+	for (i = 0; i < Z_STRLEN_P(param); i++) {
+		ch = Z_STRVAL_P(param)[i];
+		if (ch != '\0') {
+			if (ch == 172 || (ch >= 128 && ch <= 159)) {
+				continue;
+			}
+			if (ch >= 160 && ch <= 255) {
+				iso88591 = 1;
+				continue;
+			}
+		}
+		RETURN_FALSE;
+	}
+
+	if (!iso88591) {
+		RETURN_STRING("ASCII");
+	}
+
+	RETURN_STRING("ISO-8859-1");
+}
+
+/**
+ * Decodes the UTF-8 sequence at str, returns its length or 0 if it's not valid
+ * (overlong forms, surrogates and code points above U+10FFFF are rejected)
+ */
+static zend_always_inline size_t zephir_utf8_decode(const unsigned char *str, size_t length, zend_ulong *code_point)
+{
+	unsigned char c = str[0];
+
+	if (c < 0x80) {
+		*code_point = c;
+		return 1;
+	}
+
+	if (c >= 0xC2 && c <= 0xDF) {
+		if (length < 2 || (str[1] & 0xC0) != 0x80) {
+			return 0;
+		}
+		*code_point = ((zend_ulong) (c & 0x1F) << 6) | (str[1] & 0x3F);
+		return 2;
+	}
+
+	if (c >= 0xE0 && c <= 0xEF) {
+		if (length < 3 || (str[1] & 0xC0) != 0x80 || (str[2] & 0xC0) != 0x80) {
+			return 0;
+		}
+		*code_point = ((zend_ulong) (c & 0x0F) << 12) | ((zend_ulong) (str[1] & 0x3F) << 6) | (str[2] & 0x3F);
+		if (*code_point < 0x800 || (*code_point >= 0xD800 && *code_point <= 0xDFFF)) {
+			return 0;
+		}
+		return 3;
+	}
+
+	if (c >= 0xF0 && c <= 0xF4) {
+		if (length < 4 || (str[1] & 0xC0) != 0x80 || (str[2] & 0xC0) != 0x80 || (str[3] & 0xC0) != 0x80) {
+			return 0;
+		}
+		*code_point = ((zend_ulong) (c & 0x07) << 18) | ((zend_ulong) (str[1] & 0x3F) << 12) | ((zend_ulong) (str[2] & 0x3F) << 6) | (str[3] & 0x3F);
+		if (*code_point < 0x10000 || *code_point > 0x10FFFF) {
+			return 0;
+		}
+		return 4;
+	}
+
+	return 0;
+}
+
+/**
+ * Escapes every code point of an UTF-8 string that isn't alphanumeric (or whitelisted) as
+ * escape_char + lower case hexadecimal code point + escape_extra, position is the length of the
+ * prefix that doesn't need escaping. Runs of bytes that don't need escaping are located 16 bytes
+ * at a time and copied in bulk. Returns NULL if the string contains a NUL code point or invalid UTF-8
+ */
+static zend_string *zephir_escape_utf8(const unsigned char *str, size_t length, size_t position, const char *escape_char, size_t escape_length, char escape_extra, int use_whitelist)
+{
+	static const char hexdigits[] = "0123456789abcdef";
+	int filter_class = use_whitelist ? ZEPHIR_FILTER_WHITELIST : ZEPHIR_FILTER_ALNUM;
+	smart_str escaped = {0};
+	size_t run, sequence, digits;
+	zend_ulong code_point;
+	char *dest;
+
+	smart_str_alloc(&escaped, length + length / 2, 0);
+	smart_str_appendl(&escaped, (const char *) str, position);
+
+	while (position < length) {
+		sequence = zephir_utf8_decode(str + position, length - position, &code_point);
+
+		/**
+		 * CSS 2.1 section 4.1.3: "It is undefined in CSS 2.1 what happens if a
+		 * style sheet does contain a character with Unicode codepoint zero."
+		 */
+		if (sequence == 0 || code_point == 0) {
+			smart_str_free(&escaped);
+			return NULL;
+		}
+		position += sequence;
+
+		digits = 1;
+		while (digits < 6 && (code_point >> (digits * 4))) {
+			digits++;
+		}
+
+		smart_str_alloc(&escaped, escape_length + digits + 1, 0);
+		dest = ZSTR_VAL(escaped.s) + ZSTR_LEN(escaped.s);
+		memcpy(dest, escape_char, escape_length);
+		dest += escape_length;
+		while (digits--) {
+			*dest++ = hexdigits[(code_point >> (digits * 4)) & 0x0F];
+		}
+		if (escape_extra != '\0') {
+			*dest++ = escape_extra;
+		}
+		ZSTR_LEN(escaped.s) = dest - ZSTR_VAL(escaped.s);
+
+		run = zephir_filter_span(str + position, length - position, filter_class);
+		smart_str_appendl(&escaped, (const char *) str + position, run);
+		position += run;
+	}
+
+	smart_str_0(&escaped);
+	return escaped.s;
+}
+
+/**
+ * Perform escaping of non-alphanumeric characters to different formats
+ */
+static void zephir_escape_multi(zval *return_value, zval *param, const char *escape_char, size_t escape_length, char escape_extra, int use_whitelist)
+{
+	const unsigned char *str;
+	zend_string *escaped;
+	size_t prefix;
+	zval copy;
+	int use_copy = 0;
+
+	if (Z_TYPE_P(param) != IS_STRING) {
+		use_copy = zend_make_printable_zval(param, &copy);
+		if (use_copy) {
+			param = &copy;
+		}
+	}
+
+	str = (const unsigned char *) Z_STRVAL_P(param);
+	prefix = zephir_filter_span(str, Z_STRLEN_P(param), use_whitelist ? ZEPHIR_FILTER_WHITELIST : ZEPHIR_FILTER_ALNUM);
+
+	if (Z_STRLEN_P(param) == 0) {
+		RETVAL_FALSE;
+	} else if (prefix == Z_STRLEN_P(param)) {
+		/* Nothing to escape */
+		RETVAL_STR_COPY(Z_STR_P(param));
+	} else {
+		escaped = zephir_escape_utf8(str, Z_STRLEN_P(param), prefix, escape_char, escape_length, escape_extra, use_whitelist);
+		if (escaped) {
+			RETVAL_NEW_STR(escaped);
+		} else {
+			RETVAL_FALSE;
+		}
+	}
+
+	if (use_copy) {
+		zval_dtor(param);
+	}
+}
+
+/**
+ * Escapes non-alphanumeric characters to \HH+space
+ */
+void zephir_escape_css(zval *return_value, zval *param)
+{
+	zephir_escape_multi(return_value, param, "\\", sizeof("\\")-1, ' ', 0);
+}
+
+/**
+ * Escapes non-alphanumeric characters to \xHH+
+ */
+void zephir_escape_js(zval *return_value, zval *param)
+{
+	zephir_escape_multi(return_value, param, "\\x", sizeof("\\x")-1, '\0', 1);
+}
+
+/**
+ * Escapes non-alphanumeric characters to &xHH;
+ */
+void zephir_escape_htmlattr(zval *return_value, zval *param)
+{
+	zephir_escape_multi(return_value, param, "&#x", sizeof("&#x")-1, ';', 1);
+}
+
+/**
+ * Escapes HTML replacing special chars by entities
+ */
+void zephir_escape_html(zval *return_value, zval *str, zval *quote_style, zval *charset)
+{
+	if (Z_TYPE_P(str) != IS_STRING) {
+		/* Nothing to escape */
+		RETURN_ZVAL(str, 1, 0);
+	}
+
+	if (Z_TYPE_P(quote_style) != IS_LONG) {
+		php_error_docref(NULL, E_WARNING, "Invalid quote_style supplied for zephir_escape_html()");
+		RETURN_ZVAL(str, 1, 0);
+	}
+
+	if (Z_TYPE_P(charset) != IS_STRING) {
+		php_error_docref(NULL, E_WARNING, "Invalid charset supplied for zephir_escape_html()");
+		RETURN_ZVAL(str, 1, 0);
+	}
+
+	RETURN_STR(php_escape_html_entities((unsigned char *) Z_STRVAL_P(str), Z_STRLEN_P(str), 0, Z_LVAL_P(quote_style), Z_STRVAL_P(charset)));
+}
 
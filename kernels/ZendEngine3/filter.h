@@ -22,5 +22,17 @@
 
 #include <php.h>
 
+/** Low level filters */
+void zephir_filter_alphanum(zval *return_value, zval *param);
+void zephir_filter_identifier(zval *return_value, zval *param);
+
+/** Encoding */
+void zephir_is_basic_charset(zval *return_value, const zval *param);
+
+/** Escaping */
+void zephir_escape_css(zval *return_value, zval *param);
+void zephir_escape_js(zval *return_value, zval *param);
+void zephir_escape_htmlattr(zval *return_value, zval *param);
+void zephir_escape_html(zval *return_value, zval *str, zval *quote_style, zval *charset);
 
 #endif
\ No newline at end of file
@@ -25,6 +25,12 @@
 
 #define ZEPHIR_MAX_MEMORY_STACK 48
 #define ZEPHIR_MAX_CACHE_SLOTS 512
+#define ZEPHIR_MAX_CALLABLE_SLOTS 128
+#define ZEPHIR_CALLABLE_CACHE_WAYS 4
+#define ZEPHIR_CALLABLE_CACHE_NAME 48
+#define ZEPHIR_MAX_CLASS_ENTRY_SLOTS 256
+#define ZEPHIR_MAX_IN_ARRAY_SLOTS 16
+#define ZEPHIR_MAX_CAMELIZE_SLOTS 64
 
 /** Memory frame */
 typedef struct _zephir_memory_entry {
@@ -67,6 +73,46 @@ typedef zend_function zephir_fcall_cache_entry;
 
 #endif
 
+/** Resolution of an [object, method] callable seen by a call site */
+typedef struct _zephir_callable_cache_entry {
+	zend_class_entry *ce;
+	zend_class_entry *scope;
+	zend_fcall_info_cache fcc;
+	size_t method_length;
+	char method[ZEPHIR_CALLABLE_CACHE_NAME];
+} zephir_callable_cache_entry;
+
+/** Polymorphic cache of the callables invoked from a call_user_func/call_user_func_array call site */
+typedef struct _zephir_callable_cache {
+	unsigned int next;
+	zephir_callable_cache_entry entries[ZEPHIR_CALLABLE_CACHE_WAYS];
+} zephir_callable_cache;
+
+/** Class entry resolved by a fetch-class/instanceof/new/class_exists call site in the current request */
+typedef struct _zephir_class_entry_cache {
+	zend_string *name;
+	zend_class_entry *ce;
+} zephir_class_entry_cache;
+
+/** Value index of a haystack searched repeatedly by in_array, built after a few lookups */
+typedef struct _zephir_in_array_cache {
+	zend_array *haystack;
+	HashTable *index;
+	Bucket *data;
+	uint32_t used;
+	uint32_t elements;
+	zend_long next_free_element;
+	uint32_t lookups;
+	zend_uchar type;
+} zephir_in_array_cache;
+
+/** Camelized/uncamelized forms of an interned string */
+typedef struct _zephir_camelize_cache {
+	zend_string *input;
+	zend_string *camelized;
+	zend_string *uncamelized;
+} zephir_camelize_cache;
+
 #define ZEPHIR_INIT_FUNCS(class_functions) static const zend_function_entry class_functions[] =
 
 /** Define FASTCALL */
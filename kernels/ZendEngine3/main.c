@@ -368,6 +368,55 @@ zend_class_entry* zephir_get_internal_ce(const char *class_name, unsigned int cl
     return temp_ce;
 }
 
+/* Strings created by zephir_interned_string_init that the engine could not intern, the extension owns them */
+static zend_string **zephir_owned_interned_strings = NULL;
+static size_t zephir_owned_interned_count = 0;
+static size_t zephir_owned_interned_size = 0;
+
+/**
+ * Creates a persistent interned string at MINIT, its hash is computed only once.
+ * Strings that the engine cannot intern (ZTS before PHP 7.3) stay as regular refcounted strings,
+ * the extension keeps a reference to them until zephir_interned_strings_destroy at MSHUTDOWN
+ */
+zend_string *zephir_interned_string_init(const char *str, size_t len)
+{
+	zend_string *interned = zend_string_init(str, len, 1), **owned;
+
+	zend_string_hash_val(interned);
+	interned = zend_new_interned_string(interned);
+	if (!ZSTR_IS_INTERNED(interned)) {
+		if (zephir_owned_interned_count == zephir_owned_interned_size) {
+			owned = realloc(zephir_owned_interned_strings, sizeof(zend_string *) * (zephir_owned_interned_size ? zephir_owned_interned_size * 2 : 64));
+			if (owned) {
+				zephir_owned_interned_strings = owned;
+				zephir_owned_interned_size = zephir_owned_interned_size ? zephir_owned_interned_size * 2 : 64;
+			}
+		}
+		if (zephir_owned_interned_count < zephir_owned_interned_size) {
+			zephir_owned_interned_strings[zephir_owned_interned_count++] = interned;
+		}
+	}
+
+	return interned;
+}
+
+/**
+ * Releases the strings owned by the extension, the engine frees the ones it interned
+ */
+void zephir_interned_strings_destroy(void)
+{
+	size_t i;
+
+	for (i = 0; i < zephir_owned_interned_count; i++) {
+		zend_string_release(zephir_owned_interned_strings[i]);
+	}
+
+	free(zephir_owned_interned_strings);
+	zephir_owned_interned_strings = NULL;
+	zephir_owned_interned_count = 0;
+	zephir_owned_interned_size = 0;
+}
+
 /* Declare constants */
 int zephir_declare_class_constant(zend_class_entry *ce, const char *name, size_t name_length, zval *value)
 {
@@ -165,6 +165,7 @@
 /** Return string restoring memory frame */
 #define RETURN_MM_STRING(str)       { RETVAL_STRING(str); ZEPHIR_MM_RESTORE(); return; }
 #define RETURN_MM_EMPTY_STRING()    { RETVAL_EMPTY_STRING(); ZEPHIR_MM_RESTORE(); return; }
+#define RETURN_MM_INTERNED_STR(str) { ZVAL_INTERNED_STR(return_value, str); ZEPHIR_MM_RESTORE(); return; }
 
 /* Return long */
 #define RETURN_MM_LONG(value)       { RETVAL_LONG(value); ZEPHIR_MM_RESTORE(); return; }
@@ -210,6 +211,10 @@ int zephir_is_scalar(zval *var);
 int zephir_function_exists_ex(const char *func_name, unsigned int func_len);
 zend_class_entry* zephir_get_internal_ce(const char *class_name, unsigned int class_name_len);
 
+/* Interned strings */
+zend_string *zephir_interned_string_init(const char *str, size_t len);
+void zephir_interned_strings_destroy(void);
+
 /* types */
 void zephir_gettype(zval *return_value, zval *arg);
 
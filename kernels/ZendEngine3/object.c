@@ -50,6 +50,15 @@ int zephir_instance_of_ev(const zval *object, const zend_class_entry *ce)
  * Check if an object is instance of a class
  */
 int zephir_is_instance_of(zval *object, const char *class_name, unsigned int class_length)
+{
+	return zephir_is_instance_of_cached(object, class_name, class_length, 0);
+}
+
+/**
+ * Checks if an object is instance of a class whose name is only known at runtime,
+ * the class entry is cached per call site
+ */
+int zephir_is_instance_of_cached(zval *object, const char *class_name, unsigned int class_length, int cache_slot)
 {
 	zend_class_entry *ce, *temp_ce;
 
@@ -62,7 +71,7 @@ int zephir_is_instance_of(zval *object, const char *class_name, unsigned int cla
 			}
 		}
 
-		temp_ce = zephir_fetch_class_str_ex(class_name, class_length, ZEND_FETCH_CLASS_DEFAULT);
+		temp_ce = zephir_fetch_class_str_cached(class_name, class_length, ZEND_FETCH_CLASS_DEFAULT, cache_slot);
 		if (temp_ce) {
 			return instanceof_function(ce, temp_ce);
 		}
@@ -134,6 +143,102 @@ zend_class_entry *zephir_fetch_class(const zval *class_name)
 	return zephir_fetch_class_str_ex(SL("stdclass"), ZEND_FETCH_CLASS_DEFAULT);
 }
 
+/**
+ * Returns the class entry cached by a call site if it was resolved from the same class name.
+ * Names relative to the executing scope (self, parent, static) are never cached
+ */
+static zephir_class_entry_cache *zephir_class_entry_cache_get(const char *class_name, size_t length, int cache_slot)
+{
+	zend_zephir_globals_def *zephir_globals_ptr = ZEPHIR_VGLOBAL;
+
+	if (cache_slot <= 0 || cache_slot >= ZEPHIR_MAX_CLASS_ENTRY_SLOTS || !zephir_globals_ptr->cache_enabled) {
+		return NULL;
+	}
+
+	if ((length == 4 && !zend_binary_strcasecmp(class_name, length, SL("self")))
+		|| (length == 6 && (!zend_binary_strcasecmp(class_name, length, SL("parent")) || !zend_binary_strcasecmp(class_name, length, SL("static"))))) {
+		return NULL;
+	}
+
+	return &zephir_globals_ptr->cecache[cache_slot];
+}
+
+static zend_always_inline zend_class_entry *zephir_class_entry_cache_find(zephir_class_entry_cache *entry, const char *class_name, size_t length)
+{
+	if (entry && entry->ce && ZSTR_LEN(entry->name) == length && !zend_binary_strcasecmp(ZSTR_VAL(entry->name), length, class_name, length)) {
+		return entry->ce;
+	}
+
+	return NULL;
+}
+
+static void zephir_class_entry_cache_store(zephir_class_entry_cache *entry, const char *class_name, size_t length, zend_class_entry *ce)
+{
+	if (entry && ce) {
+		if (entry->name) {
+			zend_string_release(entry->name);
+		}
+		entry->name = zend_string_init(class_name, length, 0);
+		entry->ce = ce;
+	}
+}
+
+/**
+ * Releases the class names kept by the class entries cache, it is called at the end of every request
+ */
+void zephir_class_entry_cache_destroy(void)
+{
+	zend_zephir_globals_def *zephir_globals_ptr = ZEPHIR_VGLOBAL;
+	int i;
+
+	for (i = 0; i < ZEPHIR_MAX_CLASS_ENTRY_SLOTS; i++) {
+		if (zephir_globals_ptr->cecache[i].name) {
+			zend_string_release(zephir_globals_ptr->cecache[i].name);
+		}
+		zephir_globals_ptr->cecache[i].name = NULL;
+		zephir_globals_ptr->cecache[i].ce = NULL;
+	}
+}
+
+/**
+ * Fetches a class entry caching it per call site, the cache is filled on the first successful lookup
+ */
+zend_class_entry *zephir_fetch_class_str_cached(const char *class_name, size_t length, int fetch_type, int cache_slot)
+{
+	zephir_class_entry_cache *entry = zephir_class_entry_cache_get(class_name, length, cache_slot);
+	zend_class_entry *ce;
+
+	if ((ce = zephir_class_entry_cache_find(entry, class_name, length)) != NULL) {
+		return ce;
+	}
+
+	ce = zephir_fetch_class_str_ex((char *) class_name, length, fetch_type);
+	zephir_class_entry_cache_store(entry, class_name, length, ce);
+	return ce;
+}
+
+/**
+ * Fetches a zend class entry from a zval value caching it per call site
+ */
+zend_class_entry *zephir_fetch_class_cached(const zval *class_name, int cache_slot)
+{
+	zephir_class_entry_cache *entry;
+	zend_class_entry *ce;
+
+	if (Z_TYPE_P(class_name) != IS_STRING) {
+		return zephir_fetch_class(class_name);
+	}
+
+	entry = zephir_class_entry_cache_get(Z_STRVAL_P(class_name), Z_STRLEN_P(class_name), cache_slot);
+	if ((ce = zephir_class_entry_cache_find(entry, Z_STRVAL_P(class_name), Z_STRLEN_P(class_name))) != NULL) {
+		return ce;
+	}
+
+	ce = zend_fetch_class(Z_STR_P(class_name), ZEND_FETCH_CLASS_DEFAULT);
+	zephir_class_entry_cache_store(entry, Z_STRVAL_P(class_name), Z_STRLEN_P(class_name), ce);
+	return ce;
+}
+
 /**
  * Returns a class name into a zval result
  */
@@ -293,10 +398,24 @@ void zephir_get_ns_class(zval *result, zval *object, int lower)
  */
 int zephir_class_exists(const zval *class_name, int autoload)
 {
+	return zephir_class_exists_cached(class_name, autoload, 0);
+}
+
+/**
+ * Checks if a class exist caching the class entry per call site once it is found
+ */
+int zephir_class_exists_cached(const zval *class_name, int autoload, int cache_slot)
+{
+	zephir_class_entry_cache *entry;
 	zend_class_entry *ce;
 
 	if (Z_TYPE_P(class_name) == IS_STRING) {
-		if ((ce = zend_lookup_class(Z_STR_P(class_name))) != NULL) {
+		entry = zephir_class_entry_cache_get(Z_STRVAL_P(class_name), Z_STRLEN_P(class_name), cache_slot);
+		if ((ce = zephir_class_entry_cache_find(entry, Z_STRVAL_P(class_name), Z_STRLEN_P(class_name))) == NULL) {
+			ce = zend_lookup_class(Z_STR_P(class_name));
+			zephir_class_entry_cache_store(entry, Z_STRVAL_P(class_name), Z_STRLEN_P(class_name), ce);
+		}
+		if (ce != NULL) {
 			return (ce->ce_flags & (ZEND_ACC_INTERFACE | (ZEND_ACC_TRAIT - ZEND_ACC_EXPLICIT_ABSTRACT_CLASS))) == 0;
 		}
 		return 0;
@@ -375,6 +494,21 @@ int zephir_isset_property(zval *object, const char *property_name, unsigned int
 	return 0;
 }
 
+/**
+ * Checks if a property exists on object using an interned property name
+ */
+int zephir_isset_property_str(zval *object, zend_string *property)
+{
+	if (Z_TYPE_P(object) == IS_OBJECT) {
+		if (likely(zend_hash_exists(&Z_OBJCE_P(object)->properties_info, property))) {
+			return 1;
+		}
+		return zend_hash_exists(Z_OBJ_HT_P(object)->get_properties(object), property);
+	}
+
+	return 0;
+}
+
 /**
  * Checks if string property exists on object
  */
@@ -394,13 +528,21 @@ int zephir_isset_property_zval(zval *object, const zval *property)
 	return 0;
 }
 
-static inline zend_class_entry *zephir_lookup_class_ce(zend_class_entry *ce, const char *property_name, unsigned int property_length)
+/**
+ * Returns the class that declares a visible property, the name is hashed only once when it is a zend_string
+ */
+static inline zend_class_entry *zephir_lookup_class_ce_ex(zend_class_entry *ce, zend_string *property, const char *property_name, size_t property_length)
 {
 	zend_class_entry *original_ce = ce;
 	zend_property_info *info;
 
 	while (ce) {
-		if ((info = zend_hash_str_find_ptr(&ce->properties_info, property_name, property_length)) != NULL && (info->flags & ZEND_ACC_SHADOW) != ZEND_ACC_SHADOW)  {
+		if (property) {
+			info = zend_hash_find_ptr(&ce->properties_info, property);
+		} else {
+			info = zend_hash_str_find_ptr(&ce->properties_info, property_name, property_length);
+		}
+		if (info != NULL && (info->flags & ZEND_ACC_SHADOW) != ZEND_ACC_SHADOW)  {
 			return ce;
 		}
 		ce = ce->parent;
@@ -408,11 +550,13 @@ static inline zend_class_entry *zephir_lookup_class_ce(zend_class_entry *ce, con
 	return original_ce;
 }
 
+#define zephir_lookup_class_ce(ce, property_name, property_length) zephir_lookup_class_ce_ex(ce, NULL, property_name, property_length)
+#define zephir_lookup_class_ce_str(ce, property) zephir_lookup_class_ce_ex(ce, property, NULL, 0)
 
 /**
- * Reads a property from an object
+ * Reads a property from an object using an interned property name
  */
-int zephir_read_property(zval *result, zval *object, const char *property_name, zend_uint property_length, int flags)
+int zephir_read_property_str(zval *result, zval *object, zend_string *property_name, int flags)
 {
 	zval property;
 	zend_class_entry *ce, *old_scope;
@@ -424,7 +568,7 @@ int zephir_read_property(zval *result, zval *object, const char *property_name,
 	if (Z_TYPE_P(object) != IS_OBJECT) {
 
 		if ((flags & PH_NOISY) == PH_NOISY) {
-			php_error_docref(NULL, E_NOTICE, "Trying to get property \"%s\" of non-object", property_name);
+			php_error_docref(NULL, E_NOTICE, "Trying to get property \"%s\" of non-object", ZSTR_VAL(property_name));
 		}
 
 		ZVAL_NULL(result);
@@ -433,7 +577,7 @@ int zephir_read_property(zval *result, zval *object, const char *property_name,
 
 	ce = Z_OBJCE_P(object);
 	if (ce->parent) {
-		ce = zephir_lookup_class_ce(ce, property_name, property_length);
+		ce = zephir_lookup_class_ce_str(ce, property_name);
 	}
 
 	old_scope = EG(scope);
@@ -443,10 +587,10 @@ int zephir_read_property(zval *result, zval *object, const char *property_name,
 		const char *class_name;
 
 		class_name = Z_OBJ_P(object) ? ZSTR_VAL(Z_OBJCE_P(object)->name) : "";
-		zend_error(E_CORE_ERROR, "Property %s of class %s cannot be read", property_name, class_name);
+		zend_error(E_CORE_ERROR, "Property %s of class %s cannot be read", ZSTR_VAL(property_name), class_name);
 	}
 
-	ZVAL_STRINGL(&property, property_name, property_length);
+	ZVAL_STR(&property, property_name);
 
 	res = Z_OBJ_HT_P(object)->read_property(object, &property, flags ? BP_VAR_IS : BP_VAR_R, NULL, &tmp);
 	if ((flags & PH_READONLY) == PH_READONLY) {
@@ -455,12 +599,25 @@ int zephir_read_property(zval *result, zval *object, const char *property_name,
 		ZVAL_COPY(result, res);
 	}
 
-	zval_ptr_dtor(&property);
-
 	EG(scope) = old_scope;
 	return SUCCESS;
 }
 
+/**
+ * Reads a property from an object
+ */
+int zephir_read_property(zval *result, zval *object, const char *property_name, zend_uint property_length, int flags)
+{
+	zend_string *property;
+	int status;
+
+	property = zend_string_init(property_name, property_length, 0);
+	status = zephir_read_property_str(result, object, property, flags);
+	zend_string_release(property);
+
+	return status;
+}
+
 /**
  * Fetches a property using a const char
  */
@@ -516,13 +673,13 @@ int zephir_read_property_zval(zval *result, zval *object, zval *property, int fl
 		return FAILURE;
 	}
 
-	return zephir_read_property(result, object, Z_STRVAL_P(property), Z_STRLEN_P(property), flags);
+	return zephir_read_property_str(result, object, Z_STR_P(property), flags);
 }
 
 /**
- * Checks whether obj is an object and updates property with another zval
+ * Checks whether obj is an object and updates property with another zval using an interned property name
  */
-int zephir_update_property_zval(zval *object, const char *property_name, unsigned int property_length, zval *value)
+int zephir_update_property_zval_str(zval *object, zend_string *property_name, zval *value)
 {
 	zend_class_entry *ce, *old_scope;
 	zval property;
@@ -535,7 +692,7 @@ int zephir_update_property_zval(zval *object, const char *property_name, unsigne
 
 	ce = Z_OBJCE_P(object);
 	if (ce->parent) {
-		ce = zephir_lookup_class_ce(ce, property_name, property_length);
+		ce = zephir_lookup_class_ce_str(ce, property_name);
 	}
 
 	EG(scope) = ce;
@@ -544,19 +701,63 @@ int zephir_update_property_zval(zval *object, const char *property_name, unsigne
 		const char *class_name;
 
 		class_name = Z_OBJ_P(object) ? ZSTR_VAL(Z_OBJCE_P(object)->name) : "";
-		zend_error(E_CORE_ERROR, "Property %s of class %s cannot be updated", property_name, class_name);
+		zend_error(E_CORE_ERROR, "Property %s of class %s cannot be updated", ZSTR_VAL(property_name), class_name);
 	}
 
-	ZVAL_STRINGL(&property, property_name, property_length);
+	ZVAL_STR(&property, property_name);
 
 	/* write_property will add 1 to refcount, so no Z_TRY_ADDREF_P(value); is necessary */
 	Z_OBJ_HT_P(object)->write_property(object, &property, value, 0);
-	zval_ptr_dtor(&property);
 
 	EG(scope) = old_scope;
 	return SUCCESS;
 }
 
+/**
+ * Checks whether obj is an object and updates property with another zval
+ */
+int zephir_update_property_zval(zval *object, const char *property_name, unsigned int property_length, zval *value)
+{
+	zend_string *property;
+	int status;
+
+	property = zend_string_init(property_name, property_length, 0);
+	status = zephir_update_property_zval_str(object, property, value);
+	zend_string_release(property);
+
+	return status;
+}
+
+/**
+ * Returns the slot offset of a declared property, it is resolved once the class is registered
+ */
+uint32_t zephir_get_property_offset(zend_class_entry *ce, const char *property_name, unsigned int property_length)
+{
+	zend_property_info *info;
+
+	info = zend_hash_str_find_ptr(&ce->properties_info, property_name, property_length);
+	if (!info || (info->flags & (ZEND_ACC_STATIC | ZEND_ACC_SHADOW))) {
+		return ZEPHIR_INVALID_PROPERTY_OFFSET;
+	}
+
+	return info->offset;
+}
+
+/**
+ * Returns the slot offset of a declared static property in the static members table of the class
+ */
+uint32_t zephir_get_static_property_offset(zend_class_entry *ce, const char *property_name, unsigned int property_length)
+{
+	zend_property_info *info;
+
+	info = zend_hash_str_find_ptr(&ce->properties_info, property_name, property_length);
+	if (!info || (info->flags & (ZEND_ACC_STATIC | ZEND_ACC_SHADOW)) != ZEND_ACC_STATIC) {
+		return ZEPHIR_INVALID_PROPERTY_OFFSET;
+	}
+
+	return info->offset;
+}
+
 /**
  * Checks whether obj is an object and updates zval property with another zval
  */
@@ -570,15 +771,87 @@ int zephir_update_property_zval_zval(zval *object, zval *property, zval *value)
 	return zephir_update_property_zval(object, Z_STRVAL_P(property), Z_STRLEN_P(property), value);
 }
 
+/**
+ * Fetches a property for write through get_property_ptr_ptr and returns the array stored in its slot,
+ * separated when it's shared, so it can be mutated in place. NULL is returned when the handlers don't
+ * expose the slot (magic accessors) or the property holds something other than an array, null properties
+ * are initialized to an empty array unless they are fetched for BP_VAR_UNSET. get_property_ptr_ptr creates
+ * missing properties, so for BP_VAR_UNSET only properties that are already set take this path
+ */
+static zval *zephir_fetch_property_array_ptr(zval *object, const char *property_name, zend_uint property_length, int type)
+{
+	zval property, *ptr;
+	zend_class_entry *ce, *old_scope;
+
+	if (!Z_OBJ_HT_P(object)->get_property_ptr_ptr) {
+		return NULL;
+	}
+
+	ce = Z_OBJCE_P(object);
+	if (ce->parent) {
+		ce = zephir_lookup_class_ce(ce, property_name, property_length);
+	}
+
+	old_scope = EG(scope);
+	EG(scope) = ce;
+
+	ZVAL_STRINGL(&property, property_name, property_length);
+	if (type == BP_VAR_UNSET && (
+		Z_OBJ_HT_P(object)->has_property != zend_std_has_property ||
+		Z_OBJCE_P(object)->__isset ||
+		!Z_OBJ_HT_P(object)->has_property(object, &property, 2, NULL)
+	)) {
+		ptr = NULL;
+	} else {
+		ptr = Z_OBJ_HT_P(object)->get_property_ptr_ptr(object, &property, type, NULL);
+	}
+	zval_ptr_dtor(&property);
+
+	EG(scope) = old_scope;
+
+	if (!ptr || ptr == &EG(error_zval)) {
+		return NULL;
+	}
+
+	ZVAL_DEREF(ptr);
+	if (Z_TYPE_P(ptr) != IS_ARRAY) {
+		if (Z_TYPE_P(ptr) > IS_NULL || type == BP_VAR_UNSET) {
+			return NULL;
+		}
+		array_init(ptr);
+	} else {
+		SEPARATE_ARRAY(ptr);
+	}
+
+	return ptr;
+}
+
 /**
  * Updates an array property
  */
 int zephir_update_property_array(zval *object, const char *property, zend_uint property_length, const zval *index, zval *value)
 {
-	zval tmp;
+	zval tmp, *arr;
 	int separated = 0;
 
 	if (Z_TYPE_P(object) == IS_OBJECT) {
+
+		if ((arr = zephir_fetch_property_array_ptr(object, property, property_length, BP_VAR_W)) != NULL) {
+			Z_TRY_ADDREF_P(value);
+
+			if (Z_TYPE_P(index) == IS_STRING) {
+				zend_symtable_str_update(Z_ARRVAL_P(arr), Z_STRVAL_P(index), Z_STRLEN_P(index), value);
+			} else if (Z_TYPE_P(index) == IS_LONG) {
+				zend_hash_index_update(Z_ARRVAL_P(arr), Z_LVAL_P(index), value);
+			} else if (Z_TYPE_P(index) == IS_NULL) {
+				zend_hash_next_index_insert(Z_ARRVAL_P(arr), value);
+			} else {
+				Z_TRY_DELREF_P(value);
+			}
+
+			return SUCCESS;
+		}
+
 		zephir_read_property(&tmp, object, property, property_length, PH_NOISY | PH_READONLY);
 
 		/** Separation only when refcount > 1 */
@@ -630,7 +903,7 @@ int zephir_update_property_array(zval *object, const char *property, zend_uint p
  */
 int zephir_update_property_array_append(zval *object, char *property, unsigned int property_length, zval *value)
 {
-	zval tmp;
+	zval tmp, *arr;
 	int separated = 0;
 
 	ZVAL_UNDEF(&tmp);
@@ -639,6 +912,14 @@ int zephir_update_property_array_append(zval *object, char *property, unsigned i
 		return SUCCESS;
 	}
 
+	if ((arr = zephir_fetch_property_array_ptr(object, property, property_length, BP_VAR_W)) != NULL) {
+		Z_TRY_ADDREF_P(value);
+		if (!zend_hash_next_index_insert(Z_ARRVAL_P(arr), value)) {
+			Z_TRY_DELREF_P(value);
+		}
+		return SUCCESS;
+	}
+
 	zephir_read_property(&tmp, object, property, property_length, PH_NOISY_CC);
 
 	Z_TRY_DELREF(tmp);
@@ -685,10 +966,18 @@ int zephir_update_property_array_append(zval *object, char *property, unsigned i
 int zephir_update_property_array_multi(zval *object, const char *property, zend_uint property_length, zval *value, const char *types, int types_length, int types_count, ...)
 {
 	va_list ap;
-	zval tmp_arr;
+	zval tmp_arr, *arr;
 	int separated = 0;
 
 	if (Z_TYPE_P(object) == IS_OBJECT) {
+
+		if ((arr = zephir_fetch_property_array_ptr(object, property, property_length, BP_VAR_W)) != NULL) {
+			va_start(ap, types_count);
+			zephir_array_update_multi_ex(arr, value, types, types_length, types_count, ap);
+			va_end(ap);
+			return SUCCESS;
+		}
+
 		zephir_read_property(&tmp_arr, object, property, property_length, PH_NOISY | PH_READONLY);
 
 		/** Separation only when refcount > 1 */
@@ -729,6 +1018,19 @@ int zephir_update_property_array_multi(zval *object, const char *property, zend_
 	return SUCCESS;
 }
 
+/**
+ * Returns the array stored in a property ready to be updated in place by a nested update,
+ * NULL when it can't be written through its slot and zephir_update_property_array_multi must be used
+ */
+zval *zephir_fetch_property_nested(zval *object, const char *property, zend_uint property_length)
+{
+	if (Z_TYPE_P(object) != IS_OBJECT) {
+		return NULL;
+	}
+
+	return zephir_fetch_property_array_ptr(object, property, property_length, BP_VAR_W);
+}
+
 int zephir_unset_property(zval* object, const char* name)
 {
 	if (Z_TYPE_P(object) == IS_OBJECT) {
@@ -754,11 +1056,16 @@ int zephir_unset_property(zval* object, const char* name)
  */
 int zephir_unset_property_array(zval *object, char *property, unsigned int property_length, zval *index)
 {
-	zval tmp;
+	zval tmp, *arr;
 	int separated = 0;
 
 	if (Z_TYPE_P(object) == IS_OBJECT) {
 
+		if ((arr = zephir_fetch_property_array_ptr(object, property, property_length, BP_VAR_UNSET)) != NULL) {
+			zephir_array_unset(arr, index, 0);
+			return SUCCESS;
+		}
+
 		zephir_read_property(&tmp, object, property, property_length, PH_NOISY_CC);
 		Z_TRY_DELREF(tmp);
 
@@ -967,6 +1274,31 @@ int zephir_update_static_property_array_multi_ce(zend_class_entry *ce, const cha
 	return SUCCESS;
 }
 
+/**
+ * Returns the array stored in a static property ready to be updated in place by a nested update,
+ * NULL when zephir_update_static_property_array_multi_ce must be used
+ */
+zval *zephir_fetch_static_property_nested(zend_class_entry *ce, const char *property, zend_uint property_length)
+{
+	zval *slot = zephir_std_get_static_property(ce, property, property_length, 1, NULL);
+
+	if (!slot) {
+		return NULL;
+	}
+
+	ZVAL_DEINDIRECT(slot);
+	ZVAL_DEREF(slot);
+	if (Z_TYPE_P(slot) == IS_ARRAY) {
+		SEPARATE_ARRAY(slot);
+	} else if (Z_TYPE_P(slot) == IS_NULL) {
+		array_init(slot);
+	} else {
+		return NULL;
+	}
+
+	return slot;
+}
+
 /**
  * Increments an object property
  */
@@ -1042,6 +1374,14 @@ int zephir_create_closure_ex(zval *return_value, zval *this_ptr, zend_class_entr
  * Creates a new instance dynamically. Call constructor without parameters
  */
 int zephir_create_instance(zval *return_value, const zval *class_name)
+{
+	return zephir_create_instance_cached(return_value, class_name, 0);
+}
+
+/**
+ * Creates a new instance dynamically caching the class entry per call site
+ */
+int zephir_create_instance_cached(zval *return_value, const zval *class_name, int cache_slot)
 {
 	zend_class_entry *ce;
 
@@ -1050,7 +1390,7 @@ int zephir_create_instance(zval *return_value, const zval *class_name)
 		return FAILURE;
 	}
 
-	ce = zend_fetch_class(Z_STR_P(class_name), ZEND_FETCH_CLASS_DEFAULT);
+	ce = zephir_fetch_class_cached(class_name, cache_slot);
 	if (!ce) {
 		ZVAL_NULL(return_value);
 		return FAILURE;
@@ -1058,7 +1398,7 @@ int zephir_create_instance(zval *return_value, const zval *class_name)
 
 	object_init_ex(return_value, ce);
 	if (zephir_has_constructor_ce(ce)) {
-		return zephir_call_class_method_aparams(NULL, ce, zephir_fcall_method, return_value, SL("__construct"), NULL, 0, 0, NULL);
+		return zephir_call_class_method_aparams(NULL, ce, zephir_fcall_method, return_value, SL("__construct"), NULL, 0, 0, NULL, 0);
 	}
 
 	return SUCCESS;
@@ -23,16 +23,21 @@
 
 #include <php.h>
 #include <Zend/zend.h>
+#include <Zend/zend_execute.h>
 
 #include "kernel/globals.h"
 #include "kernel/main.h"
 
 /** Class Retrieving/Checking */
 int zephir_class_exists(const zval *class_name, int autoload);
+int zephir_class_exists_cached(const zval *class_name, int autoload, int cache_slot);
 int zephir_interface_exists(const zval *interface_name, int autoload);
 void zephir_get_called_class(zval *return_value);
 zend_class_entry *zephir_fetch_class(const zval *class_name);
 zend_class_entry *zephir_fetch_class_str_ex(char *class_name, size_t length, int fetch_type);
+zend_class_entry *zephir_fetch_class_cached(const zval *class_name, int cache_slot);
+zend_class_entry *zephir_fetch_class_str_cached(const char *class_name, size_t length, int fetch_type, int cache_slot);
+void zephir_class_entry_cache_destroy(void);
 void zephir_get_class(zval *result, zval *object, int lower);
 void zephir_get_class_ns(zval *result, zval *object, int lower TSRMLS_DC);
 void zephir_get_ns_class(zval *result, zval *object, int lower TSRMLS_DC);
@@ -40,6 +45,7 @@ void zephir_get_ns_class(zval *result, zval *object, int lower TSRMLS_DC);
 /** Cloning/Instance of */
 int zephir_clone(zval *destination, zval *obj);
 int zephir_is_instance_of(zval *object, const char *class_name, unsigned int class_length);
+int zephir_is_instance_of_cached(zval *object, const char *class_name, unsigned int class_length, int cache_slot);
 int zephir_instance_of_ev(const zval *object, const zend_class_entry *ce);
 int zephir_zval_is_traversable(zval *object);
 
@@ -49,10 +55,12 @@ int zephir_method_exists(const zval *object, const zval *method_name);
 /** Isset properties */
 int zephir_isset_property(zval *object, const char *property_name, unsigned int property_length);
 int zephir_isset_property_zval(zval *object, const zval *property);
+int zephir_isset_property_str(zval *object, zend_string *property);
 
 /** Reading properties */
 int zephir_read_property(zval *result, zval *object, const char *property_name, zend_uint property_length, int silent);
 int zephir_read_property_zval(zval *result, zval *object, zval *property, int silent);
+int zephir_read_property_str(zval *result, zval *object, zend_string *property_name, int flags);
 int zephir_return_property(zval *return_value, zval *object, char *property_name, unsigned int property_length);
 int zephir_fetch_property(zval *result, zval *object, const char *property_name, zend_uint property_length, int silent);
 int zephir_fetch_property_zval(zval *result, zval *object, zval *property, int silent);
@@ -60,12 +68,66 @@ int zephir_fetch_property_zval(zval *result, zval *object, zval *property, int s
 /** Updating properties */
 int zephir_update_property_zval(zval *obj, const char *property_name, unsigned int property_length, zval *value);
 int zephir_update_property_zval_zval(zval *obj, zval *property, zval *value);
+int zephir_update_property_zval_str(zval *obj, zend_string *property_name, zval *value);
+
+/** Declared properties */
+#define ZEPHIR_INVALID_PROPERTY_OFFSET ((uint32_t) -1)
+
+uint32_t zephir_get_property_offset(zend_class_entry *ce, const char *property_name, unsigned int property_length);
+
+/**
+ * Reads a declared property straight from its slot, undefined properties and
+ * objects with their own handlers go through zephir_read_property
+ */
+static zend_always_inline int zephir_read_property_offset(zval *result, zval *object, uint32_t offset, const char *property_name, zend_uint property_length, int flags)
+{
+	zval *slot;
+
+	if (EXPECTED(Z_TYPE_P(object) == IS_OBJECT && offset != ZEPHIR_INVALID_PROPERTY_OFFSET && Z_OBJ_HT_P(object)->read_property == zend_std_read_property)) {
+		slot = OBJ_PROP(Z_OBJ_P(object), offset);
+		if (EXPECTED(Z_TYPE_P(slot) != IS_UNDEF)) {
+			if ((flags & PH_READONLY) == PH_READONLY) {
+				ZVAL_COPY_VALUE(result, slot);
+			} else {
+				ZVAL_COPY(result, slot);
+			}
+			return SUCCESS;
+		}
+	}
+
+	return zephir_read_property(result, object, property_name, property_length, flags);
+}
+
+/**
+ * Updates a declared property straight in its slot, undefined properties and
+ * objects with their own handlers go through zephir_update_property_zval
+ */
+static zend_always_inline int zephir_update_property_offset(zval *object, uint32_t offset, const char *property_name, unsigned int property_length, zval *value)
+{
+	zval garbage, *slot;
+
+	if (EXPECTED(Z_TYPE_P(object) == IS_OBJECT && offset != ZEPHIR_INVALID_PROPERTY_OFFSET && Z_OBJ_HT_P(object)->write_property == zend_std_write_property)) {
+		slot = OBJ_PROP(Z_OBJ_P(object), offset);
+		if (EXPECTED(Z_TYPE_P(slot) != IS_UNDEF)) {
+			/* Same as zend_std_write_property, references bound to the property keep pointing to it */
+			ZVAL_DEREF(value);
+			ZVAL_DEREF(slot);
+			ZVAL_COPY_VALUE(&garbage, slot);
+			ZVAL_COPY(slot, value);
+			zval_ptr_dtor(&garbage);
+			return SUCCESS;
+		}
+	}
+
+	return zephir_update_property_zval(object, property_name, property_length, value);
+}
 
 /** Updating array properties */
 int zephir_update_property_array(zval *object, const char *property, zend_uint property_length, const zval *index, zval *value);
 int zephir_update_property_array_string(zval *object, char *property, unsigned int property_length, char *index, unsigned int index_length, zval *value);
 int zephir_update_property_array_append(zval *object, char *property, unsigned int property_length, zval *value);
 int zephir_update_property_array_multi(zval *object, const char *property, zend_uint property_length, zval *value, const char *types, int types_length, int types_count, ...);
+zval *zephir_fetch_property_nested(zval *object, const char *property, zend_uint property_length);
 
 /** Unset properties */
 int zephir_unset_property(zval* object, const char* name);
@@ -75,12 +137,71 @@ int zephir_unset_property_array(zval *object, char *property, unsigned int prope
 int zephir_read_static_property_ce(zval *result, zend_class_entry *ce, const char *property, int len, int flags);
 int zephir_update_static_property_ce(zend_class_entry *ce, const char *name, int len, zval *value);
 int zephir_update_static_property_array_multi_ce(zend_class_entry *ce, const char *property, zend_uint property_length, zval *value, const char *types, int types_length, int types_count, ...);
+zval *zephir_fetch_static_property_nested(zend_class_entry *ce, const char *property, zend_uint property_length);
+
+uint32_t zephir_get_static_property_offset(zend_class_entry *ce, const char *property_name, unsigned int property_length);
+
+/**
+ * Returns the slot of a declared static property, NULL when the static members
+ * of the class aren't initialized yet for this thread
+ */
+static zend_always_inline zval *zephir_static_property_slot(zend_class_entry *ce, uint32_t offset)
+{
+	zval *slot;
+
+	if (UNEXPECTED(offset == ZEPHIR_INVALID_PROPERTY_OFFSET || !(ce->ce_flags & ZEND_ACC_CONSTANTS_UPDATED) || CE_STATIC_MEMBERS(ce) == NULL)) {
+		return NULL;
+	}
+
+	slot = CE_STATIC_MEMBERS(ce) + offset;
+	ZVAL_DEINDIRECT(slot);
+	ZVAL_DEREF(slot);
+	return slot;
+}
+
+/**
+ * Reads a declared static property straight from its slot
+ */
+static zend_always_inline int zephir_read_static_property_offset(zval *result, zend_class_entry *ce, uint32_t offset, const char *property, int len, int flags)
+{
+	zval *slot = zephir_static_property_slot(ce, offset);
+
+	if (EXPECTED(slot != NULL)) {
+		if ((flags & PH_READONLY) == PH_READONLY) {
+			ZVAL_COPY_VALUE(result, slot);
+		} else {
+			ZVAL_COPY(result, slot);
+		}
+		return SUCCESS;
+	}
+
+	return zephir_read_static_property_ce(result, ce, property, len, flags);
+}
+
+/**
+ * Updates a declared static property straight in its slot
+ */
+static zend_always_inline int zephir_update_static_property_offset(zend_class_entry *ce, uint32_t offset, const char *name, int len, zval *value)
+{
+	zval garbage, *slot = zephir_static_property_slot(ce, offset);
+
+	if (EXPECTED(slot != NULL)) {
+		ZVAL_DEREF(value);
+		ZVAL_COPY_VALUE(&garbage, slot);
+		ZVAL_COPY(slot, value);
+		zval_ptr_dtor(&garbage);
+		return SUCCESS;
+	}
+
+	return zephir_update_static_property_ce(ce, name, len, value);
+}
 
 /** Create closures */
 int zephir_create_closure_ex(zval *return_value, zval *this_ptr, zend_class_entry *ce, const char *method_name, zend_uint method_length);
 
 /** Create instances */
 int zephir_create_instance(zval *return_value, const zval *class_name);
+int zephir_create_instance_cached(zval *return_value, const zval *class_name, int cache_slot);
 
 /** Increment/Decrement properties */
 #define zephir_property_incr(object, property) zephir_property_incr_decr(object, property, 1)
@@ -160,6 +160,163 @@ void zephir_concat_self_str(zval *left, const char *right, int right_length)
 	}
 }
 
+/**
+ * Appends a long to the left operator
+ */
+void zephir_concat_self_long(zval *left, const long right)
+{
+	char buffer[MAX_LENGTH_OF_LONG + 1];
+	int length = slprintf(buffer, sizeof(buffer), "%ld", right);
+
+	zephir_concat_self_str(left, buffer, length);
+}
+
+/**
+ * Makes room for length bytes in the string held by left. The string grows geometrically and
+ * the spare room left by the allocator is used before reallocating, a string appended to in a
+ * loop is therefore reallocated a logarithmic number of times and never copied to be separated
+ */
+static zend_string *zephir_concat_grow(zval *left, size_t length)
+{
+	zend_string *source = Z_STR_P(left), *target;
+	size_t capacity;
+
+	if (!ZSTR_IS_INTERNED(source) && GC_REFCOUNT(source) == 1) {
+#if !ZEND_DEBUG
+		/* Debug builds keep allocation info at the end of the block */
+		if (zend_mem_block_size(source) >= ZEND_MM_ALIGNED_SIZE(_ZSTR_STRUCT_SIZE(length))) {
+			zend_string_forget_hash_val(source);
+			return source;
+		}
+#endif
+	}
+
+	capacity = ZSTR_LEN(source) * 2;
+	if (capacity < length) {
+		capacity = length;
+	}
+
+	if (!ZSTR_IS_INTERNED(source) && GC_REFCOUNT(source) == 1) {
+		target = zend_string_realloc(source, capacity, 0);
+	} else {
+		target = zend_string_alloc(capacity, 0);
+		memcpy(ZSTR_VAL(target), ZSTR_VAL(source), ZSTR_LEN(source));
+		zend_string_release(source);
+	}
+
+	ZVAL_NEW_STR(left, target);
+	return target;
+}
+
+/**
+ * Appends a buffer to the left operator keeping spare capacity for the next appends
+ */
+void zephir_concat_self_grow_str(zval *left, const char *right, int right_length)
+{
+	zval left_copy;
+	size_t left_length, offset = 0;
+	int use_copy = 0, self = 0;
+	zend_string *target;
+
+	/* Shared strings are separated by zephir_concat_grow, which copies them straight into the larger buffer */
+	ZVAL_DEREF(left);
+	if (Z_TYPE_P(left) == IS_NULL) {
+		ZVAL_EMPTY_STRING(left);
+	} else if (Z_TYPE_P(left) != IS_STRING) {
+		use_copy = zephir_make_printable_zval(left, &left_copy);
+		if (use_copy) {
+			ZEPHIR_CPY_WRT_CTOR(left, (&left_copy));
+		}
+	}
+
+	left_length = Z_STRLEN_P(left);
+
+	/* The right buffer may live in the left string itself (s .= s), growing moves or frees it */
+	if (right >= Z_STRVAL_P(left) && right < Z_STRVAL_P(left) + left_length) {
+		offset = right - Z_STRVAL_P(left);
+		self = 1;
+	}
+
+	target = zephir_concat_grow(left, left_length + right_length);
+	if (self) {
+		right = ZSTR_VAL(target) + offset;
+	}
+	memcpy(ZSTR_VAL(target) + left_length, right, right_length);
+	ZSTR_LEN(target) = left_length + right_length;
+	ZSTR_VAL(target)[ZSTR_LEN(target)] = '\0';
+
+	if (use_copy) {
+		zval_dtor(&left_copy);
+	}
+}
+
+/**
+ * Appends the content of the right operator to the left operator keeping spare capacity for the next appends
+ */
+void zephir_concat_self_grow(zval *left, zval *right)
+{
+	zval right_copy;
+	int use_copy_right = 0;
+
+	if (Z_TYPE_P(right) != IS_STRING) {
+		use_copy_right = zephir_make_printable_zval(right, &right_copy);
+		if (use_copy_right) {
+			right = &right_copy;
+		}
+	}
+
+	zephir_concat_self_grow_str(left, Z_STRVAL_P(right), Z_STRLEN_P(right));
+
+	if (use_copy_right) {
+		zval_dtor(&right_copy);
+	}
+}
+
+/**
+ * Appends a long to the left operator keeping spare capacity for the next appends
+ */
+void zephir_concat_self_grow_long(zval *left, const long right)
+{
+	char buffer[MAX_LENGTH_OF_LONG + 1];
+	int length = slprintf(buffer, sizeof(buffer), "%ld", right);
+
+	zephir_concat_self_grow_str(left, buffer, length);
+}
+
+/**
+ * Appends a char to the left operator keeping spare capacity for the next appends
+ */
+void zephir_concat_self_grow_char(zval *left, unsigned char right)
+{
+	zephir_concat_self_grow_str(left, (const char *) &right, 1);
+}
+
+/**
+ * Gives back the spare capacity of a string grown by zephir_concat_self_grow* once the loop appending to it is left
+ */
+void zephir_concat_self_trim(zval *left)
+{
+	zend_string *source;
+
+	ZVAL_DEREF(left);
+	if (Z_TYPE_P(left) != IS_STRING) {
+		return;
+	}
+
+	source = Z_STR_P(left);
+	if (ZSTR_IS_INTERNED(source) || GC_REFCOUNT(source) != 1) {
+		return;
+	}
+
+#if !ZEND_DEBUG
+	if (zend_mem_block_size(source) <= ZEND_MM_ALIGNED_SIZE(_ZSTR_STRUCT_SIZE(ZSTR_LEN(source)))) {
+		return;
+	}
+#endif
+
+	ZVAL_NEW_STR(left, zend_string_truncate(source, ZSTR_LEN(source), 0));
+}
+
 /**
  * Natural compare with long operandus on right
  */
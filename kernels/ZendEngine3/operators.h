@@ -79,6 +79,13 @@ void zephir_concat_self_str(zval *left, const char *right, int right_length);
 void zephir_concat_self_long(zval *left, const long right);
 void zephir_concat_self_char(zval *left, unsigned char right);
 
+/* concatenation inside loops, the left operator keeps spare capacity between appends */
+void zephir_concat_self_grow(zval *left, zval *right);
+void zephir_concat_self_grow_str(zval *left, const char *right, int right_length);
+void zephir_concat_self_grow_long(zval *left, const long right);
+void zephir_concat_self_grow_char(zval *left, unsigned char right);
+void zephir_concat_self_trim(zval *left);
+
 /** Strict comparing */
 int zephir_compare_strict_string(zval *op1, const char *op2, int op2_length);
 int zephir_compare_strict_long(zval *op1, long op2);
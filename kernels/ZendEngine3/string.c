@@ -41,6 +41,7 @@
 
 #ifdef ZEPHIR_USE_PHP_PCRE
 #include <ext/pcre/php_pcre.h>
+#include <ext/standard/basic_functions.h>
 #endif
 
 #ifdef ZEPHIR_USE_PHP_JSON
@@ -53,6 +54,18 @@
 #include "kernel/operators.h"
 #include "kernel/fcall.h"
 
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && (defined(__clang__) || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define ZEPHIR_X86_DISPATCH 1
+#include <cpuid.h>
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+#endif
+
 #define PH_RANDOM_ALNUM 0
 #define PH_RANDOM_ALPHA 1
 #define PH_RANDOM_HEXDEC 2
@@ -74,37 +87,123 @@ int zephir_spprintf(char **message, int max_len, char *format, ...)
 }
 
 /**
- * Fast call to php strlen
+ * Returns the offset of the first byte in the range [from, from + 26) or length if there is none,
+ * 16 bytes are checked at once by biasing the range to the bottom of the signed byte range
  */
-int zephir_fast_strlen_ev(zval *str)
+static size_t zephir_ascii_find_range(const char *str, size_t length, char from)
 {
-	zval copy;
-	int use_copy = 0, length;
-
-	if (Z_TYPE_P(str) != IS_STRING) {
-		use_copy = zend_make_printable_zval(str, &copy);
-		if (use_copy) {
-			str = &copy;
+	size_t i = 0;
+
+#ifdef __SSE2__
+	const __m128i bias = _mm_set1_epi8((char) (128 - from));
+	const __m128i limit = _mm_set1_epi8((char) (-128 + 26));
+	int mask;
+
+	for (; i + 16 <= length; i += 16) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *) (str + i));
+		mask = _mm_movemask_epi8(_mm_cmplt_epi8(_mm_add_epi8(chunk, bias), limit));
+		if (mask) {
+			return i + __builtin_ctz(mask);
 		}
 	}
+#endif
 
-	length = Z_STRLEN_P(str);
-	if (use_copy) {
-		zval_dtor(str);
+	for (; i < length; i++) {
+		if ((unsigned char) (str[i] - from) < 26) {
+			return i;
+		}
 	}
 
 	return length;
 }
 
 /**
- * Fast call to php strtolower
+ * Counts the bytes in the range [from, from + 26)
  */
-void zephir_fast_strtolower(zval *return_value, zval *str)
+static size_t zephir_ascii_count_range(const char *str, size_t length, char from)
+{
+	size_t i = 0, count = 0;
+
+#ifdef __SSE2__
+	const __m128i bias = _mm_set1_epi8((char) (128 - from));
+	const __m128i limit = _mm_set1_epi8((char) (-128 + 26));
+
+	for (; i + 16 <= length; i += 16) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *) (str + i));
+		count += __builtin_popcount(_mm_movemask_epi8(_mm_cmplt_epi8(_mm_add_epi8(chunk, bias), limit)));
+	}
+#endif
+
+	for (; i < length; i++) {
+		if ((unsigned char) (str[i] - from) < 26) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+/**
+ * Checks whether a buffer only has 7-bit ASCII bytes
+ */
+static int zephir_ascii_only(const char *str, size_t length)
+{
+	size_t i = 0;
+
+#ifdef __SSE2__
+	__m128i bits = _mm_setzero_si128();
+
+	for (; i + 16 <= length; i += 16) {
+		bits = _mm_or_si128(bits, _mm_loadu_si128((const __m128i *) (str + i)));
+	}
+	if (_mm_movemask_epi8(bits)) {
+		return 0;
+	}
+#endif
+
+	for (; i < length; i++) {
+		if ((unsigned char) str[i] >= 0x80) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/**
+ * Copies a buffer flipping the case of the bytes in the range [from, from + 26)
+ */
+static void zephir_ascii_flip_case(char *dest, const char *str, size_t length, char from)
+{
+	size_t i = 0;
+
+#ifdef __SSE2__
+	const __m128i bias = _mm_set1_epi8((char) (128 - from));
+	const __m128i limit = _mm_set1_epi8((char) (-128 + 26));
+	const __m128i flip = _mm_set1_epi8(0x20);
+
+	for (; i + 16 <= length; i += 16) {
+		__m128i chunk = _mm_loadu_si128((const __m128i *) (str + i));
+		__m128i mask = _mm_cmplt_epi8(_mm_add_epi8(chunk, bias), limit);
+		_mm_storeu_si128((__m128i *) (dest + i), _mm_xor_si128(chunk, _mm_and_si128(mask, flip)));
+	}
+#endif
+
+	for (; i < length; i++) {
+		dest[i] = (unsigned char) (str[i] - from) < 26 ? str[i] ^ 0x20 : str[i];
+	}
+}
+
+/**
+ * Converts the case of a string, the original string is returned when nothing changes
+ * Strings with non-ASCII bytes are left to PHP so locale rules still apply to them
+ */
+static void zephir_ascii_convert_case(zval *return_value, zval *str, char from)
 {
 	zval copy;
 	int use_copy = 0;
-	char *lower_str;
-	unsigned int length;
+	size_t offset, length;
+	zend_string *converted;
 
 	if (Z_TYPE_P(str) != IS_STRING) {
 		use_copy = zend_make_printable_zval(str, &copy);
@@ -114,26 +213,153 @@ void zephir_fast_strtolower(zval *return_value, zval *str)
 	}
 
 	length = Z_STRLEN_P(str);
-	lower_str = estrndup(Z_STRVAL_P(str), length);
-	php_strtolower(lower_str, length);
+	offset = zephir_ascii_only(Z_STRVAL_P(str), length) ? zephir_ascii_find_range(Z_STRVAL_P(str), length, from) : (size_t) -1;
+
+	if (offset == length) {
+		ZVAL_STR_COPY(return_value, Z_STR_P(str));
+	} else if (offset != (size_t) -1) {
+		converted = zend_string_alloc(length, 0);
+		memcpy(ZSTR_VAL(converted), Z_STRVAL_P(str), offset);
+		zephir_ascii_flip_case(ZSTR_VAL(converted) + offset, Z_STRVAL_P(str) + offset, length - offset, from);
+		ZSTR_VAL(converted)[length] = '\0';
+		ZVAL_NEW_STR(return_value, converted);
+	} else {
+		ZVAL_STRINGL(return_value, Z_STRVAL_P(str), length);
+		if (from == 'A') {
+			php_strtolower(Z_STRVAL_P(return_value), length);
+		} else {
+			php_strtoupper(Z_STRVAL_P(return_value), length);
+		}
+	}
 
 	if (use_copy) {
-		zval_dtor(str);
+		zval_dtor(&copy);
+	}
+}
+
+/**
+ * Finds a needle in a haystack, 16 candidate positions are checked at once by comparing the first
+ * and the last byte of the needle and only the positions where both match are compared in full.
+ * Short haystacks and the tail are left to php_memnstr
+ */
+static const char *zephir_memnstr(const char *haystack, size_t haystack_length, const char *needle, size_t needle_length)
+{
+	size_t i = 0;
+
+	if (needle_length > haystack_length) {
+		return NULL;
+	}
+
+	if (needle_length == 0) {
+		return haystack;
+	}
+
+	if (needle_length == 1) {
+		return memchr(haystack, *needle, haystack_length);
+	}
+
+#ifdef __SSE2__
+	if (haystack_length >= 32) {
+		const __m128i first = _mm_set1_epi8(needle[0]);
+		const __m128i last = _mm_set1_epi8(needle[needle_length - 1]);
+		int mask, bit;
+
+		for (; i + needle_length + 15 <= haystack_length; i += 16) {
+			__m128i block_first = _mm_loadu_si128((const __m128i *) (haystack + i));
+			__m128i block_last = _mm_loadu_si128((const __m128i *) (haystack + i + needle_length - 1));
+
+			mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(block_first, first), _mm_cmpeq_epi8(block_last, last)));
+			while (mask) {
+				bit = __builtin_ctz(mask);
+				if (!memcmp(haystack + i + bit + 1, needle + 1, needle_length - 2)) {
+					return haystack + i + bit;
+				}
+				mask &= mask - 1;
+			}
+		}
 	}
+#endif
 
-	ZVAL_STRINGL(return_value, lower_str, length);
-	efree(lower_str);
+	return php_memnstr(haystack + i, (char *) needle, needle_length, (char *) haystack + haystack_length);
+}
+
+#define ZEPHIR_MATCHES_STACK 32
+
+static zend_always_inline void zephir_push_match(size_t **offsets, size_t *stack_offsets, size_t *capacity, size_t count, size_t offset)
+{
+	if (count == *capacity) {
+		*capacity *= 2;
+		if (*offsets == stack_offsets) {
+			*offsets = safe_emalloc(*capacity, sizeof(size_t), 0);
+			memcpy(*offsets, stack_offsets, sizeof(size_t) * ZEPHIR_MATCHES_STACK);
+		} else {
+			*offsets = safe_erealloc(*offsets, *capacity, sizeof(size_t), 0);
+		}
+	}
+	(*offsets)[count] = offset;
 }
 
 /**
- * Fast call to PHP strtoupper() function
+ * Collects the offsets of at most max non overlapping occurrences of needle in haystack and returns
+ * how many were found. The offsets are written to stack_offsets (ZEPHIR_MATCHES_STACK entries) and
+ * moved to the heap when there are more, in that case the caller must efree *offsets.
+ * Single byte needles are scanned 16 bytes at a time
  */
-void zephir_fast_strtoupper(zval *return_value, zval *str)
+static size_t zephir_collect_matches(const char *haystack, size_t haystack_length, const char *needle, size_t needle_length, size_t max, size_t *stack_offsets, size_t **offsets)
+{
+	size_t capacity = ZEPHIR_MATCHES_STACK, count = 0, position = 0;
+	const char *found;
+
+	*offsets = stack_offsets;
+	if (needle_length == 0 || max == 0) {
+		return 0;
+	}
+
+	if (needle_length == 1) {
+#ifdef __SSE2__
+		const __m128i delimiter = _mm_set1_epi8(*needle);
+		int mask;
+
+		for (; position + 16 <= haystack_length; position += 16) {
+			mask = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (haystack + position)), delimiter));
+			while (mask) {
+				zephir_push_match(offsets, stack_offsets, &capacity, count, position + __builtin_ctz(mask));
+				if (++count == max) {
+					return count;
+				}
+				mask &= mask - 1;
+			}
+		}
+#endif
+		for (; position < haystack_length; position++) {
+			if (haystack[position] == *needle) {
+				zephir_push_match(offsets, stack_offsets, &capacity, count, position);
+				if (++count == max) {
+					break;
+				}
+			}
+		}
+		return count;
+	}
+
+	while ((found = zephir_memnstr(haystack + position, haystack_length - position, needle, needle_length))) {
+		zephir_push_match(offsets, stack_offsets, &capacity, count, found - haystack);
+		position = found - haystack + needle_length;
+		if (++count == max) {
+			break;
+		}
+	}
+
+	return count;
+}
+
+/**
+ * Fast call to php strlen
+ */
+int zephir_fast_strlen_ev(zval *str)
 {
 	zval copy;
-	int use_copy = 0;
-	char *lower_str;
-	unsigned int length;
+	int use_copy = 0, length;
 
 	if (Z_TYPE_P(str) != IS_STRING) {
 		use_copy = zend_make_printable_zval(str, &copy);
@@ -143,15 +369,27 @@ void zephir_fast_strtoupper(zval *return_value, zval *str)
 	}
 
 	length = Z_STRLEN_P(str);
-	lower_str = estrndup(Z_STRVAL_P(str), length);
-	php_strtoupper(lower_str, length);
-
 	if (use_copy) {
 		zval_dtor(str);
 	}
 
-	ZVAL_STRINGL(return_value, lower_str, length);
-	efree(lower_str);
+	return length;
+}
+
+/**
+ * Fast call to php strtolower
+ */
+void zephir_fast_strtolower(zval *return_value, zval *str)
+{
+	zephir_ascii_convert_case(return_value, str, 'A');
+}
+
+/**
+ * Fast call to PHP strtoupper() function
+ */
+void zephir_fast_strtoupper(zval *return_value, zval *str)
+{
+	zephir_ascii_convert_case(return_value, str, 'a');
 }
 
 /**
@@ -270,6 +508,101 @@ void zephir_substr(zval *return_value, zval *str, long f, long l, int flags)
 	return;
 }
 
+/**
+ * Returns the number of characters needed to print a long
+ */
+static zend_always_inline size_t zephir_long_length(zend_long value)
+{
+	size_t length = 1;
+	zend_ulong magnitude;
+
+	if (value < 0) {
+		length++;
+		magnitude = (zend_ulong) 0 - (zend_ulong) value;
+	} else {
+		magnitude = (zend_ulong) value;
+	}
+
+	while (magnitude >= 10) {
+		magnitude /= 10;
+		length++;
+	}
+
+	return length;
+}
+
+typedef struct _zephir_join_piece {
+	zend_string *str;
+	zend_long lval;
+	size_t length;
+} zephir_join_piece;
+
+/**
+ * Joins the elements of pieces with glue. The length of every element is computed first (longs are
+ * measured without converting them into strings) so the result is allocated once and filled in order
+ */
+static void zephir_join(zval *return_value, const char *glue, size_t glue_length, HashTable *pieces)
+{
+	zephir_join_piece stack_pieces[16], *items, *item;
+	uint32_t count = zend_hash_num_elements(pieces);
+	size_t length = 0;
+	zend_string *result;
+	zval *element;
+	char *target;
+
+	if (count == 0) {
+		RETURN_EMPTY_STRING();
+	} else if (count == 1) {
+		/* loop to search the first not undefined element... */
+		ZEND_HASH_FOREACH_VAL(pieces, element) {
+			RETURN_STR(zval_get_string(element));
+		} ZEND_HASH_FOREACH_END();
+	}
+
+	items = count <= 16 ? stack_pieces : safe_emalloc(count, sizeof(zephir_join_piece), 0);
+	item = items;
+
+	ZEND_HASH_FOREACH_VAL(pieces, element) {
+		ZVAL_DEREF(element);
+		if (Z_TYPE_P(element) == IS_LONG) {
+			item->str = NULL;
+			item->lval = Z_LVAL_P(element);
+			item->length = zephir_long_length(Z_LVAL_P(element));
+		} else {
+			item->str = zval_get_string(element);
+			item->length = ZSTR_LEN(item->str);
+		}
+		length += item->length;
+		item++;
+	} ZEND_HASH_FOREACH_END();
+
+	count = item - items;
+	result = zend_string_safe_alloc(count - 1, glue_length, length, 0);
+	target = ZSTR_VAL(result);
+
+	for (item = items; item < items + count; item++) {
+		if (item != items) {
+			memcpy(target, glue, glue_length);
+			target += glue_length;
+		}
+		if (item->str) {
+			memcpy(target, ZSTR_VAL(item->str), item->length);
+			zend_string_release(item->str);
+		} else {
+			/* zend_print_long_to_buf writes backwards from the end of the number */
+			zend_print_long_to_buf(target + item->length, item->lval);
+		}
+		target += item->length;
+	}
+	*target = '\0';
+
+	if (items != stack_pieces) {
+		efree(items);
+	}
+
+	RETURN_NEW_STR(result);
+}
+
 /**
  * Fast call to php join  function
  */
@@ -281,7 +614,7 @@ void zephir_fast_join(zval *result, zval *glue, zval *pieces)
 		return;
 	}
 
-	php_implode(Z_STR_P(glue), pieces, result);
+	zephir_join(result, Z_STRVAL_P(glue), Z_STRLEN_P(glue), Z_ARRVAL_P(pieces));
 }
 
 /**
@@ -291,146 +624,340 @@ void zephir_fast_join(zval *result, zval *glue, zval *pieces)
  */
 void zephir_fast_join_str(zval *return_value, char *glue, unsigned int glue_length, zval *pieces)
 {
-	zval         *tmp;
-	int           numelems;
-	zend_string  *str;
-	char         *cptr;
-	size_t        len = 0;
-	zend_string **strings, **strptr;
-	zend_array *arr;
-
 	if (Z_TYPE_P(pieces) != IS_ARRAY) {
 		php_error_docref(NULL, E_WARNING, "Invalid arguments supplied for fast_join()");
 		RETURN_EMPTY_STRING();
 	}
 
-	arr = Z_ARRVAL_P(pieces);
-	numelems = zend_hash_num_elements(arr);
+	zephir_join(return_value, glue, glue_length, Z_ARRVAL_P(pieces));
+}
 
-	if (numelems == 0) {
-		RETURN_EMPTY_STRING();
-	} else if (numelems == 1) {
-		/* loop to search the first not undefined element... */
-		ZEND_HASH_FOREACH_VAL(arr, tmp) {
-			RETURN_STR(zval_get_string(tmp));
-		} ZEND_HASH_FOREACH_END();
+/**
+ * ASCII case mapping, other bytes are left as they are
+ */
+static const unsigned char zephir_ascii_upper[256] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+	0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+	0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+	0x60, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+	0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+	0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+	0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+	0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+	0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+	0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+	0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+	0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+	0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+};
+
+static const unsigned char zephir_ascii_lower[256] = {
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+	0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f,
+	0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+	0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f,
+	0x40, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+	0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+	0x60, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+	0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
+	0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+	0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+	0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+	0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+	0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+	0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+	0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+	0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+};
+
+/**
+ * Returns the memo slot of an interned string, or NULL if the string can't be memoized.
+ * Interned strings are unique for the whole request so their address identifies them
+ */
+static zephir_camelize_cache *zephir_camelize_cache_slot(zend_string *str)
+{
+	zend_zephir_globals_def *zephir_globals_ptr = ZEPHIR_VGLOBAL;
+
+	if (!ZSTR_IS_INTERNED(str) || !zephir_globals_ptr->cache_enabled) {
+		return NULL;
 	}
 
-	strings = emalloc((sizeof(zend_long) + sizeof(zend_string *)) * numelems);
-	strptr = strings - 1;
+	return &zephir_globals_ptr->cmcache[zend_string_hash_val(str) % ZEPHIR_MAX_CAMELIZE_SLOTS];
+}
 
-	ZEND_HASH_FOREACH_VAL(arr, tmp) {
-		if (Z_TYPE_P(tmp) == IS_LONG) {
-			double val = Z_LVAL_P(tmp);
-			*++strptr = NULL;
-			((zend_long *) (strings + numelems))[strptr - strings] = Z_LVAL_P(tmp);
-			if (val < 0) {
-				val = -10 * val;
-			}
-			if (val < 10) {
-				len++;
-			} else {
-				len += (int) log10(10 * (double) val);
+static void zephir_camelize_cache_release(zephir_camelize_cache *entry)
+{
+	if (entry->camelized) {
+		zend_string_release(entry->camelized);
+	}
+	if (entry->uncamelized) {
+		zend_string_release(entry->uncamelized);
+	}
+
+	memset(entry, 0, sizeof(zephir_camelize_cache));
+}
+
+void zephir_camelize_cache_destroy(void)
+{
+	zend_zephir_globals_def *zephir_globals_ptr = ZEPHIR_VGLOBAL;
+	int i;
+
+	for (i = 0; i < ZEPHIR_MAX_CAMELIZE_SLOTS; i++) {
+		zephir_camelize_cache_release(&zephir_globals_ptr->cmcache[i]);
+	}
+}
+
+/**
+ * Stores the transformation of an interned string, a slot holds the results for one input
+ */
+static void zephir_camelize_cache_store(zephir_camelize_cache *entry, zend_string *input, zend_string *result, int uncamelized)
+{
+	if (entry->input != input) {
+		zephir_camelize_cache_release(entry);
+		entry->input = input;
+	}
+
+	if (uncamelized) {
+		entry->uncamelized = zend_string_copy(result);
+	} else {
+		entry->camelized = zend_string_copy(result);
+	}
+}
+
+/**
+ * Camelizes str into a string allocated once with the length of the input: leading separators
+ * are skipped, the byte after a separator is upper cased and the rest are lower cased
+ */
+static zend_string *zephir_camelize_str(zend_string *str)
+{
+	const unsigned char *source = (const unsigned char *) ZSTR_VAL(str);
+	size_t length = ZSTR_LEN(str), i = 0;
+	zend_string *camelized;
+	unsigned char *dest;
+
+	while (i < length && (source[i] == '-' || source[i] == '_')) {
+		i++;
+	}
+
+	camelized = zend_string_alloc(length - i, 0);
+	dest = (unsigned char *) ZSTR_VAL(camelized);
+
+	if (i < length) {
+		*dest++ = zephir_ascii_upper[source[i++]];
+	}
+
+	for (; i < length; i++) {
+		if (source[i] == '-' || source[i] == '_') {
+			if (i != length - 1) {
+				i++;
+				*dest++ = zephir_ascii_upper[source[i]];
 			}
-		} else {
-			*++strptr = zval_get_string(tmp);
-			len += ZSTR_LEN(*strptr);
+			continue;
 		}
-	} ZEND_HASH_FOREACH_END();
+		*dest++ = zephir_ascii_lower[source[i]];
+	}
+	*dest = '\0';
 
-	str = zend_string_alloc(len + (numelems - 1) * glue_length, 0);
-	cptr = ZSTR_VAL(str) + ZSTR_LEN(str);
-	*cptr = 0;
+	ZSTR_LEN(camelized) = dest - (unsigned char *) ZSTR_VAL(camelized);
+	return camelized;
+}
 
-	do {
-		if (*strptr) {
-			cptr -= ZSTR_LEN(*strptr);
-			memcpy(cptr, ZSTR_VAL(*strptr), ZSTR_LEN(*strptr));
-			zend_string_release(*strptr);
-		} else {
-			char *oldPtr = cptr;
-			char oldVal = *cptr;
-			zend_long val = ((zend_long *) (strings + numelems))[strptr - strings];
-			cptr = zend_print_long_to_buf(cptr, val);
-			*oldPtr = oldVal;
+/**
+ * Uncamelizes str up to its first NUL byte, the upper case letters are counted first so the
+ * result is allocated once. Returns a copy of str when there's nothing to change
+ */
+static zend_string *zephir_uncamelize_str(zend_string *str)
+{
+	const unsigned char *source = (const unsigned char *) ZSTR_VAL(str), *end;
+	size_t length, offset, uppers;
+	zend_string *uncamelized;
+	unsigned char *dest;
+
+	end = memchr(source, '\0', ZSTR_LEN(str));
+	length = end ? (size_t) (end - source) : ZSTR_LEN(str);
+
+	offset = zephir_ascii_find_range((const char *) source, length, 'A');
+	if (offset == length) {
+		if (length == ZSTR_LEN(str)) {
+			return zend_string_copy(str);
 		}
+		return zend_string_init((const char *) source, length, 0);
+	}
+
+	/**
+	 * The result length is known once the upper case letters are counted, the lower case prefix is copied as is
+	 */
+	uppers = zephir_ascii_count_range((const char *) source + offset, length - offset, 'A');
+	uncamelized = zend_string_alloc(length + uppers - (offset == 0 ? 1 : 0), 0);
+	dest = (unsigned char *) ZSTR_VAL(uncamelized);
 
-		cptr -= glue_length;
-		memcpy(cptr, glue, glue_length);
-	} while (--strptr > strings);
+	memcpy(dest, source, offset);
+	dest += offset;
 
-	if (*strptr) {
-		memcpy(ZSTR_VAL(str), ZSTR_VAL(*strptr), ZSTR_LEN(*strptr));
-		zend_string_release(*strptr);
-	} else {
-		char *oldPtr = cptr;
-		char oldVal = *cptr;
-		zend_print_long_to_buf(cptr, ((zend_long *) (strings + numelems))[strptr - strings]);
-		*oldPtr = oldVal;
+	for (; offset < length; offset++) {
+		if (zephir_ascii_lower[source[offset]] != source[offset]) {
+			if (offset > 0) {
+				*dest++ = '_';
+			}
+			*dest++ = zephir_ascii_lower[source[offset]];
+		} else {
+			*dest++ = source[offset];
+		}
 	}
+	*dest = '\0';
 
-	efree(strings);
-	RETURN_NEW_STR(str);
+	return uncamelized;
 }
 
 /**
  * Convert dash/underscored texts returning camelized
  */
+void zephir_camelize(zval *return_value, const zval *str)
+{
+	zephir_camelize_cache *entry;
+	zend_string *camelized;
+
+	if (unlikely(Z_TYPE_P(str) != IS_STRING)) {
+		zend_error(E_WARNING, "Invalid arguments supplied for camelize()");
+		RETURN_EMPTY_STRING();
+	}
+
+	entry = zephir_camelize_cache_slot(Z_STR_P(str));
+	if (entry && entry->input == Z_STR_P(str) && entry->camelized) {
+		RETURN_STR_COPY(entry->camelized);
+	}
+
+	camelized = zephir_camelize_str(Z_STR_P(str));
+	if (entry) {
+		zephir_camelize_cache_store(entry, Z_STR_P(str), camelized, 0);
+	}
+
+	RETURN_STR(camelized);
+}
+
+/**
+ * Convert camelized texts returning dash/underscored
+ */
 void zephir_uncamelize(zval *return_value, const zval *str)
 {
-	unsigned int i;
-	smart_str uncamelize_str = {0};
-	char *marker, ch;
+	zephir_camelize_cache *entry;
+	zend_string *uncamelized;
 
 	if (Z_TYPE_P(str) != IS_STRING) {
 		zend_error(E_WARNING, "Invalid arguments supplied for camelize()");
 		return;
 	}
 
-	marker = Z_STRVAL_P(str);
-	for (i = 0; i < Z_STRLEN_P(str); i++) {
-		ch = *marker;
-		if (ch == '\0') {
-			break;
-		}
-		if (ch >= 'A' && ch <= 'Z') {
-			if (i > 0) {
-				smart_str_appendc(&uncamelize_str, '_');
-			}
-			smart_str_appendc(&uncamelize_str, (*marker) + 32);
-		} else {
-			smart_str_appendc(&uncamelize_str, (*marker));
+	entry = zephir_camelize_cache_slot(Z_STR_P(str));
+	if (entry && entry->input == Z_STR_P(str) && entry->uncamelized) {
+		RETURN_STR_COPY(entry->uncamelized);
+	}
+
+	uncamelized = zephir_uncamelize_str(Z_STR_P(str));
+	if (entry && uncamelized != Z_STR_P(str)) {
+		zephir_camelize_cache_store(entry, Z_STR_P(str), uncamelized, 1);
+	}
+
+	RETURN_STR(uncamelized);
+}
+
+/**
+ * Check if a string is contained into another
+ */
+int zephir_memnstr_str(const zval *haystack, char *needle, unsigned int needle_length ZEPHIR_DEBUG_PARAMS)
+{
+	if (Z_TYPE_P(haystack) != IS_STRING) {
+		#ifndef ZEPHIR_RELEASE
+		zend_error(E_WARNING, "Invalid arguments supplied for memnstr in %s on line %d", file, line);
+		#else
+		zend_error(E_WARNING, "Invalid arguments supplied for memnstr()");
+		#endif
+		return 0;
+	}
+
+	if (Z_STRLEN_P(haystack) >= needle_length) {
+		return zephir_memnstr(Z_STRVAL_P(haystack), Z_STRLEN_P(haystack), needle, needle_length) ? 1 : 0;
+	}
+
+	return 0;
+}
+
+static zend_always_inline zend_string *zephir_explode_piece(const char *start, size_t length)
+{
+	if (length == 0) {
+		return ZSTR_EMPTY_ALLOC();
+	}
+
+#if PHP_VERSION_ID >= 70200
+	if (length == 1) {
+		return ZSTR_CHAR((zend_uchar) *start);
+	}
+#endif
+
+	return zend_string_init(start, length, 0);
+}
+
+/**
+ * Splits str by delimiter following the semantics of php's explode. The delimiters are located
+ * before the result is created so the packed array is allocated with its final size, a string
+ * without delimiters is returned as the only element without copying it and empty or single
+ * character pieces use the interned strings
+ */
+static void zephir_explode(zval *return_value, const char *delimiter, size_t delimiter_length, zend_string *str, zend_long limit)
+{
+	size_t stack_offsets[ZEPHIR_MATCHES_STACK], *offsets, count, pieces, i, start, end;
+	zval piece;
+
+	if (unlikely(delimiter_length == 0)) {
+		php_error_docref(NULL, E_WARNING, "Empty delimiter");
+		RETURN_FALSE;
+	}
+
+	if (ZSTR_LEN(str) == 0) {
+		array_init(return_value);
+		if (limit >= 0) {
+			add_next_index_str(return_value, ZSTR_EMPTY_ALLOC());
 		}
-		marker++;
+		return;
 	}
-	smart_str_0(&uncamelize_str);
 
-	if (uncamelize_str.s) {
-		RETURN_STR(uncamelize_str.s);
-	} else {
-		RETURN_EMPTY_STRING();
+	count = zephir_collect_matches(ZSTR_VAL(str), ZSTR_LEN(str), delimiter, delimiter_length, limit > 1 ? (size_t) (limit - 1) : (limit < 0 ? (size_t) -1 : 0), stack_offsets, &offsets);
+	pieces = count + 1;
+
+	if (limit < 0) {
+		if (limit <= -(zend_long) pieces) {
+			array_init(return_value);
+			pieces = 0;
+		} else {
+			pieces += limit;
+		}
 	}
-}
 
-/**
- * Check if a string is contained into another
- */
-int zephir_memnstr_str(const zval *haystack, char *needle, unsigned int needle_length ZEPHIR_DEBUG_PARAMS)
-{
-	if (Z_TYPE_P(haystack) != IS_STRING) {
-		#ifndef ZEPHIR_RELEASE
-		zend_error(E_WARNING, "Invalid arguments supplied for memnstr in %s on line %d", file, line);
-		#else
-		zend_error(E_WARNING, "Invalid arguments supplied for memnstr()");
-		#endif
-		return 0;
+	if (count == 0 && pieces == 1) {
+		array_init_size(return_value, 1);
+		add_next_index_str(return_value, zend_string_copy(str));
+		return;
 	}
 
-	if (Z_STRLEN_P(haystack) >= needle_length) {
-		return php_memnstr(Z_STRVAL_P(haystack), needle, needle_length, Z_STRVAL_P(haystack) + Z_STRLEN_P(haystack)) ? 1 : 0;
+	if (pieces > 0) {
+		array_init_size(return_value, pieces);
+		zend_hash_real_init(Z_ARRVAL_P(return_value), 1);
+		ZEND_HASH_FILL_PACKED(Z_ARRVAL_P(return_value)) {
+			for (i = 0; i < pieces; i++) {
+				start = i == 0 ? 0 : offsets[i - 1] + delimiter_length;
+				end = i < count ? offsets[i] : ZSTR_LEN(str);
+				ZVAL_STR(&piece, zephir_explode_piece(ZSTR_VAL(str) + start, end - start));
+				ZEND_HASH_FILL_ADD(&piece);
+			}
+		} ZEND_HASH_FILL_END();
 	}
 
-	return 0;
+	if (offsets != stack_offsets) {
+		efree(offsets);
+	}
 }
 
 /**
@@ -443,8 +970,7 @@ void zephir_fast_explode(zval *return_value, zval *delimiter, zval *str, long li
 		RETURN_EMPTY_STRING();
 	}
 
-	array_init(return_value);
-	php_explode(Z_STR_P(delimiter), Z_STR_P(str), return_value, limit);
+	zephir_explode(return_value, Z_STRVAL_P(delimiter), Z_STRLEN_P(delimiter), Z_STR_P(str), limit);
 }
 
 /**
@@ -452,17 +978,12 @@ void zephir_fast_explode(zval *return_value, zval *delimiter, zval *str, long li
  */
 void zephir_fast_explode_str(zval *return_value, const char *delim, int delim_length, zval *str, long limit)
 {
-	zend_string *delimiter;
-
 	if (unlikely(Z_TYPE_P(str) != IS_STRING)) {
 		zend_error(E_WARNING, "Invalid arguments supplied for explode()");
 		RETURN_EMPTY_STRING();
 	}
 
-	delimiter = zend_string_init(delim, delim_length, 0);
-	array_init(return_value);
-	php_explode(delimiter, Z_STR_P(str), return_value, limit);
-	zend_string_free(delimiter);
+	zephir_explode(return_value, delim, delim_length, Z_STR_P(str), limit);
 }
 
 /**
@@ -490,7 +1011,7 @@ void zephir_fast_strpos(zval *return_value, const zval *haystack, const zval *ne
 		return;
 	}
 
-	found = php_memnstr(Z_STRVAL_P(haystack)+offset, Z_STRVAL_P(needle), Z_STRLEN_P(needle), Z_STRVAL_P(haystack) + Z_STRLEN_P(haystack));
+	found = zephir_memnstr(Z_STRVAL_P(haystack) + offset, Z_STRLEN_P(haystack) - offset, Z_STRVAL_P(needle), Z_STRLEN_P(needle));
 
 	if (found) {
 		ZVAL_LONG(return_value, found - Z_STRVAL_P(haystack));
@@ -512,7 +1033,7 @@ void zephir_fast_strpos_str(zval *return_value, const zval *haystack, char *need
 		return;
 	}
 
-	found = php_memnstr(Z_STRVAL_P(haystack), needle, needle_length, Z_STRVAL_P(haystack) + Z_STRLEN_P(haystack));
+	found = zephir_memnstr(Z_STRVAL_P(haystack), Z_STRLEN_P(haystack), needle, needle_length);
 
 	if (found) {
 		ZVAL_LONG(return_value, found - Z_STRVAL_P(haystack));
@@ -529,6 +1050,7 @@ void zephir_fast_trim(zval *return_value, zval *str, zval *charlist, int where)
 	zval copy;
 	int use_copy = 0;
 	zend_string *trimmed;
+	const char *start, *end;
 
 	if (Z_TYPE_P(str) != IS_STRING) {
 		use_copy = zend_make_printable_zval(str, &copy);
@@ -540,7 +1062,24 @@ void zephir_fast_trim(zval *return_value, zval *str, zval *charlist, int where)
 	if (charlist && Z_TYPE_P(charlist) == IS_STRING) {
 		trimmed = php_trim(Z_STR_P(str), Z_STRVAL_P(charlist), Z_STRLEN_P(charlist), where);
 	} else {
-		trimmed = php_trim(Z_STR_P(str), NULL, 0, where);
+		/* Default charlist " \t\n\r\0\x0B", strings that need no trimming are returned as they are */
+		start = Z_STRVAL_P(str);
+		end = start + Z_STRLEN_P(str);
+		if (where & ZEPHIR_TRIM_LEFT) {
+			while (start < end && (*start == ' ' || (*start >= '\t' && *start <= '\r' && *start != '\f') || *start == '\0')) {
+				start++;
+			}
+		}
+		if (where & ZEPHIR_TRIM_RIGHT) {
+			while (end > start && (end[-1] == ' ' || (end[-1] >= '\t' && end[-1] <= '\r' && end[-1] != '\f') || end[-1] == '\0')) {
+				end--;
+			}
+		}
+		if ((size_t) (end - start) == Z_STRLEN_P(str)) {
+			trimmed = zend_string_copy(Z_STR_P(str));
+		} else {
+			trimmed = zend_string_init(start, end - start, 0);
+		}
 	}
 	ZVAL_STR(return_value, trimmed);
 
@@ -620,75 +1159,48 @@ static zend_string* php_char_to_str_ex(zend_string *str, char from, char *to, si
 }
 /* }}} */
 
-/* {{{ php_str_to_str_ex This function is subject to version 3.01 of the PHP license
+/**
+ * Replaces every occurrence of needle in haystack. The offsets of the matches are collected in a
+ * first pass so the result is allocated once with its exact length and filled without searching again
  */
-static zend_string *php_str_to_str_ex(zend_string *haystack,
-	char *needle, size_t needle_len, char *str, size_t str_len, zend_long *replace_count)
+static zend_string *zephir_str_to_str(zend_string *haystack, const char *needle, size_t needle_len, const char *str, size_t str_len, zend_long *replace_count)
 {
+	size_t stack_offsets[ZEPHIR_MATCHES_STACK], *offsets, count, i, previous = 0;
 	zend_string *new_str;
+	char *target;
 
-	if (needle_len < ZSTR_LEN(haystack)) {
-		char *end;
-		char *e, *s, *p, *r;
+	count = zephir_collect_matches(ZSTR_VAL(haystack), ZSTR_LEN(haystack), needle, needle_len, (size_t) -1, stack_offsets, &offsets);
+	if (count == 0) {
+		/* Needle doesn't occur, shortcircuit the actual replacement. */
+		return zend_string_copy(haystack);
+	}
 
-		if (needle_len == str_len) {
-			new_str = NULL;
-			end = ZSTR_VAL(haystack) + ZSTR_LEN(haystack);
-			for (p = ZSTR_VAL(haystack); (r = (char*)php_memnstr(p, needle, needle_len, end)); p = r + needle_len) {
-				if (!new_str) {
-					new_str = zend_string_init(ZSTR_VAL(haystack), ZSTR_LEN(haystack), 0);
-				}
-				memcpy(ZSTR_VAL(new_str) + (r - ZSTR_VAL(haystack)), str, str_len);
-				(*replace_count)++;
-			}
-			if (!new_str) {
-				goto nothing_todo;
-			}
-			return new_str;
-		} else {
-			size_t count = 0;
-			char *o = ZSTR_VAL(haystack);
-			char *n = needle;
-			char *endp = o + ZSTR_LEN(haystack);
-
-			while ((o = (char*)php_memnstr(o, n, needle_len, endp))) {
-				o += needle_len;
-				count++;
-			}
-			if (count == 0) {
-				/* Needle doesn't occur, shortcircuit the actual replacement. */
-				goto nothing_todo;
-			}
-			new_str = zend_string_alloc(count * (str_len - needle_len) + ZSTR_LEN(haystack), 0);
-
-			e = s = ZSTR_VAL(new_str);
-			end = ZSTR_VAL(haystack) + ZSTR_LEN(haystack);
-			for (p = ZSTR_VAL(haystack); (r = (char*)php_memnstr(p, needle, needle_len, end)); p = r + needle_len) {
-				memcpy(e, p, r - p);
-				e += r - p;
-				memcpy(e, str, str_len);
-				e += str_len;
-				(*replace_count)++;
-			}
+	if (str_len >= needle_len) {
+		new_str = zend_string_safe_alloc(count, str_len - needle_len, ZSTR_LEN(haystack), 0);
+	} else {
+		new_str = zend_string_alloc(ZSTR_LEN(haystack) - count * (needle_len - str_len), 0);
+	}
+	target = ZSTR_VAL(new_str);
 
-			if (p < end) {
-				memcpy(e, p, end - p);
-				e += end - p;
-			}
+	for (i = 0; i < count; i++) {
+		memcpy(target, ZSTR_VAL(haystack) + previous, offsets[i] - previous);
+		target += offsets[i] - previous;
+		memcpy(target, str, str_len);
+		target += str_len;
+		previous = offsets[i] + needle_len;
+	}
 
-			*e = '\0';
-			return new_str;
-		}
-	} else if (needle_len > ZSTR_LEN(haystack) || memcmp(ZSTR_VAL(haystack), needle, ZSTR_LEN(haystack))) {
-nothing_todo:
-		return zend_string_copy(haystack);
-	} else {
-		new_str = zend_string_init(str, str_len, 0);
-		(*replace_count)++;
-		return new_str;
+	memcpy(target, ZSTR_VAL(haystack) + previous, ZSTR_LEN(haystack) - previous);
+	target += ZSTR_LEN(haystack) - previous;
+	*target = '\0';
+
+	*replace_count += count;
+	if (offsets != stack_offsets) {
+		efree(offsets);
 	}
+
+	return new_str;
 }
-/* }}} */
 
 /**
  * Immediate function resolution for str_replace function
@@ -712,7 +1224,7 @@ void zephir_fast_str_replace(zval *return_value_ptr, zval *search, zval *replace
 		do {
 			zval *params[] = { search, replace, subject };
 			ZVAL_NULL(return_value_ptr);
-			zephir_call_func_aparams(return_value_ptr, "str_replace", sizeof("str_replace")-1, NULL, 0, 3, params);
+			zephir_call_func_aparams(return_value_ptr, "str_replace", sizeof("str_replace")-1, NULL, 0, 3, params, 0);
 			return;
 		} while(0);
 	}
@@ -732,11 +1244,8 @@ void zephir_fast_str_replace(zval *return_value_ptr, zval *search, zval *replace
 	}
 
 	if (Z_STRLEN_P(subject) == 0) {
-		ZVAL_STRINGL(return_value_ptr, "", 0);
-		return;
-	}
-
-	if (Z_STRLEN_P(search) == 1) {
+		ZVAL_EMPTY_STRING(return_value_ptr);
+	} else if (Z_STRLEN_P(search) == 1) {
 		ZVAL_STR(return_value_ptr, php_char_to_str_ex(Z_STR_P(subject),
 			Z_STRVAL_P(search)[0],
 			Z_STRVAL_P(replace),
@@ -745,7 +1254,7 @@ void zephir_fast_str_replace(zval *return_value_ptr, zval *search, zval *replace
 			&replace_count));
 	} else {
 		if (Z_STRLEN_P(search) > 1) {
-			ZVAL_STR(return_value_ptr, php_str_to_str_ex(Z_STR_P(subject),
+			ZVAL_STR(return_value_ptr, zephir_str_to_str(Z_STR_P(subject),
 				Z_STRVAL_P(search), Z_STRLEN_P(search),
 				Z_STRVAL_P(replace), Z_STRLEN_P(replace), &replace_count));
 		} else {
@@ -765,18 +1274,12 @@ void zephir_fast_str_replace(zval *return_value_ptr, zval *search, zval *replace
 #ifdef ZEPHIR_USE_PHP_PCRE
 
 /**
- * Execute preg-match without function lookup in the PHP userland
+ * Matches subject against a compiled regex, the subject is only converted when it isn't a string
  */
-void zephir_preg_match(zval *return_value, zval *regex, zval *subject, zval *matches, int global, long flags, long offset)
+static void zephir_preg_match_pce(zval *return_value, pcre_cache_entry *pce, zval *subject, zval *matches, int global, long flags, long offset)
 {
 	zval copy;
 	int use_copy = 0;
-	pcre_cache_entry *pce;
-
-	if (Z_TYPE_P(regex) != IS_STRING) {
-		zend_error(E_WARNING, "Invalid arguments supplied for zephir_preg_match()");
-		RETURN_FALSE;
-	}
 
 	if (Z_TYPE_P(subject) != IS_STRING) {
 		use_copy = zend_make_printable_zval(subject, &copy);
@@ -785,16 +1288,6 @@ void zephir_preg_match(zval *return_value, zval *regex, zval *subject, zval *mat
 		}
 	}
 
-	/* Compile regex or get it from cache. */
-	if ((pce = pcre_get_compiled_regex_cache(Z_STR_P(regex))) == NULL) {
-
-		if (use_copy) {
-			zval_dtor(subject);
-		}
-
-		RETURN_FALSE;
-	}
-
 	if (flags != 0 || offset != 0) {
 		php_pcre_match_impl(pce, Z_STRVAL_P(subject), Z_STRLEN_P(subject), return_value, matches, global, 1, flags, offset);
 	} else {
@@ -806,6 +1299,117 @@ void zephir_preg_match(zval *return_value, zval *regex, zval *subject, zval *mat
 	}
 }
 
+/**
+ * Execute preg-match without function lookup in the PHP userland
+ */
+void zephir_preg_match(zval *return_value, zval *regex, zval *subject, zval *matches, int global, long flags, long offset)
+{
+	pcre_cache_entry *pce;
+
+	if (Z_TYPE_P(regex) != IS_STRING) {
+		zend_error(E_WARNING, "Invalid arguments supplied for zephir_preg_match()");
+		RETURN_FALSE;
+	}
+
+	/* Compile regex or get it from cache. */
+	if ((pce = pcre_get_compiled_regex_cache(Z_STR_P(regex))) == NULL) {
+		RETURN_FALSE;
+	}
+
+	zephir_preg_match_pce(return_value, pce, subject, matches, global, flags, offset);
+}
+
+#ifndef ZTS
+/** Call site slots holding a compiled regex, released at the end of the request */
+static zephir_pcre_slot *zephir_pcre_slots = NULL;
+#endif
+
+/**
+ * Returns the LC_CTYPE locale the regex is compiled under, PCRE keeps one entry per locale
+ */
+static zend_always_inline zend_string *zephir_pcre_locale(void)
+{
+#ifdef HAVE_SETLOCALE
+#if PHP_VERSION_ID >= 80000
+	return BG(ctype_string);
+#else
+	return BG(locale_string);
+#endif
+#else
+	return NULL;
+#endif
+}
+
+/**
+ * Execute preg-match for a constant regex. The compiled regex is looked up once per request and
+ * kept in the call site's slot with the locale it was compiled under, its entry is pinned in
+ * PCRE's cache so it's never evicted meanwhile. Calls made under another locale look the regex
+ * up as usual. In ZTS builds every thread has its own PCRE cache, so the regex is looked up on
+ * every call
+ */
+void zephir_preg_match_cached(zval *return_value, zephir_pcre_slot *slot, zval *regex, zval *subject, zval *matches, int global, long flags, long offset)
+{
+#ifndef ZTS
+	pcre_cache_entry *pce = (pcre_cache_entry *) slot->pce;
+	zend_string *locale = zephir_pcre_locale();
+
+	if (EXPECTED(pce != NULL)) {
+		if (UNEXPECTED(slot->locale != locale && (!slot->locale || !locale || !zend_string_equals(slot->locale, locale)))) {
+			zephir_preg_match(return_value, regex, subject, matches, global, flags, offset);
+			return;
+		}
+	} else {
+		if (Z_TYPE_P(regex) != IS_STRING) {
+			zend_error(E_WARNING, "Invalid arguments supplied for zephir_preg_match()");
+			RETURN_FALSE;
+		}
+
+		if ((pce = pcre_get_compiled_regex_cache(Z_STR_P(regex))) == NULL) {
+			RETURN_FALSE;
+		}
+
+#if PHP_VERSION_ID >= 70300
+		php_pcre_pce_incref(pce);
+#else
+		pce->refcount++;
+#endif
+		slot->pce = pce;
+		slot->locale = locale ? zend_string_copy(locale) : NULL;
+		slot->next = zephir_pcre_slots;
+		zephir_pcre_slots = slot;
+	}
+
+	zephir_preg_match_pce(return_value, pce, subject, matches, global, flags, offset);
+#else
+	zephir_preg_match(return_value, regex, subject, matches, global, flags, offset);
+#endif
+}
+
+/**
+ * Unpins the compiled regexes kept by call sites, the next request looks them up again
+ */
+void zephir_preg_match_cache_destroy(void)
+{
+#ifndef ZTS
+	zephir_pcre_slot *slot;
+
+	while (zephir_pcre_slots) {
+		slot = zephir_pcre_slots;
+		zephir_pcre_slots = slot->next;
+
+#if PHP_VERSION_ID >= 70300
+		php_pcre_pce_decref((pcre_cache_entry *) slot->pce);
+#else
+		((pcre_cache_entry *) slot->pce)->refcount--;
+#endif
+		if (slot->locale) {
+			zend_string_release(slot->locale);
+		}
+		memset(slot, 0, sizeof(zephir_pcre_slot));
+	}
+#endif
+}
+
 #else
 
 void zephir_preg_match(zval *return_value, zval *regex, zval *subject, zval *matches, int global, long flags, long offset)
@@ -824,9 +1428,9 @@ void zephir_preg_match(zval *return_value, zval *regex, zval *subject, zval *mat
 		zval *tmp_params[5] = { regex, subject, matches, &tmp_flags, &tmp_offset };
 
 		if (global) {
-			zephir_call_func_aparams(rvp, SL("preg_match_all"), NULL, 0, 5, tmp_params);
+			zephir_call_func_aparams(rvp, SL("preg_match_all"), NULL, 0, 5, tmp_params, 0);
 		} else {
-			zephir_call_func_aparams(rvp, SL("preg_match"), NULL, 0, 5, tmp_params);
+			zephir_call_func_aparams(rvp, SL("preg_match"), NULL, 0, 5, tmp_params, 0);
 		}
 	}
 
@@ -835,6 +1439,15 @@ void zephir_preg_match(zval *return_value, zval *regex, zval *subject, zval *mat
 	}
 }
 
+void zephir_preg_match_cached(zval *return_value, zephir_pcre_slot *slot, zval *regex, zval *subject, zval *matches, int global, long flags, long offset)
+{
+	zephir_preg_match(return_value, regex, subject, matches, global, flags, offset);
+}
+
+void zephir_preg_match_cache_destroy(void)
+{
+}
+
 #endif /* ZEPHIR_USE_PHP_PCRE */
 
 #ifdef ZEPHIR_USE_PHP_JSON
@@ -884,7 +1497,7 @@ int zephir_json_encode(zval *return_value, zval *v, int opts)
 	params[0] = v;
 	params[1] = &zopts;
 
-	return zephir_return_call_function(return_value, SL("json_encode"), NULL, 0, 2, params);
+	return zephir_return_call_function(return_value, SL("json_encode"), NULL, 0, 2, params, 0);
 }
 
 int zephir_json_decode(zval *return_value, zval *v, zend_bool assoc)
@@ -898,18 +1511,200 @@ int zephir_json_decode(zval *return_value, zval *v, zend_bool assoc)
 	params[0] = v;
 	params[1] = &zassoc;
 
-	return zephir_return_call_function(return_value, SL("json_decode"), NULL, 0, 2, params);
+	return zephir_return_call_function(return_value, SL("json_decode"), NULL, 0, 2, params, 0);
 }
 
 #endif /* ZEPHIR_USE_PHP_JSON */
 
-void zephir_md5(zval *return_value, zval *str)
+#ifdef ZEPHIR_X86_DISPATCH
+
+#define ZEPHIR_CPU_PCLMUL (1 << 1)
+#define ZEPHIR_CPU_SSSE3  (1 << 9)
+
+/**
+ * Returns the ecx feature bits of cpuid leaf 1, they are read once
+ */
+static unsigned int zephir_cpu_features(void)
+{
+	static unsigned int features = 0;
+	static int detected = 0;
+	unsigned int eax, ebx, ecx, edx;
+
+	if (!detected) {
+		if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) {
+			features = ecx;
+		}
+		detected = 1;
+	}
+
+	return features;
+}
+
+/**
+ * Folds 64 bytes per iteration with carry-less multiplications and reduces the result with
+ * Barrett's method (Intel, "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ").
+ * crc is the running (inverted) state, length must be a multiple of 16 and at least 64
+ */
+__attribute__((target("pclmul,sse2")))
+static uint32_t zephir_crc32_clmul(uint32_t crc, const unsigned char *buf, size_t length)
+{
+	const __m128i k1k2 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+	const __m128i k3k4 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+	const __m128i k5k0 = _mm_set_epi64x(0, 0x0163cd6124LL);
+	const __m128i poly = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+	const __m128i mask32 = _mm_setr_epi32(~0, 0, ~0, 0);
+	__m128i x1, x2, x3, x4, x5, x6, x7, x8;
+
+	x1 = _mm_loadu_si128((const __m128i *) (buf + 0x00));
+	x2 = _mm_loadu_si128((const __m128i *) (buf + 0x10));
+	x3 = _mm_loadu_si128((const __m128i *) (buf + 0x20));
+	x4 = _mm_loadu_si128((const __m128i *) (buf + 0x30));
+	x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(crc));
+	buf += 64;
+	length -= 64;
+
+	while (length >= 64) {
+		x5 = _mm_clmulepi64_si128(x1, k1k2, 0x00);
+		x6 = _mm_clmulepi64_si128(x2, k1k2, 0x00);
+		x7 = _mm_clmulepi64_si128(x3, k1k2, 0x00);
+		x8 = _mm_clmulepi64_si128(x4, k1k2, 0x00);
+
+		x1 = _mm_clmulepi64_si128(x1, k1k2, 0x11);
+		x2 = _mm_clmulepi64_si128(x2, k1k2, 0x11);
+		x3 = _mm_clmulepi64_si128(x3, k1k2, 0x11);
+		x4 = _mm_clmulepi64_si128(x4, k1k2, 0x11);
+
+		x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128((const __m128i *) (buf + 0x00)));
+		x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128((const __m128i *) (buf + 0x10)));
+		x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128((const __m128i *) (buf + 0x20)));
+		x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128((const __m128i *) (buf + 0x30)));
+
+		buf += 64;
+		length -= 64;
+	}
+
+	/* Fold the four lanes into one */
+	x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+	x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x2), x5);
+	x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+	x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x3), x5);
+	x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+	x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), x4), x5);
+
+	while (length >= 16) {
+		x5 = _mm_clmulepi64_si128(x1, k3k4, 0x00);
+		x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, k3k4, 0x11), _mm_loadu_si128((const __m128i *) buf)), x5);
+		buf += 16;
+		length -= 16;
+	}
+
+	/* 128 to 64 bits */
+	x2 = _mm_clmulepi64_si128(x1, k3k4, 0x10);
+	x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+	x2 = _mm_srli_si128(x1, 4);
+	x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, mask32), k5k0, 0x00), x2);
+
+	/* Barrett reduction to 32 bits */
+	x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, mask32), poly, 0x10);
+	x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, mask32), poly, 0x00);
+	x1 = _mm_xor_si128(x1, x2);
+
+	return (uint32_t) _mm_cvtsi128_si32(_mm_srli_si128(x1, 4));
+}
+
+/**
+ * Encodes 12 bytes into 16 characters per iteration (Muła and Lemire, "Faster Base64 Encoding
+ * and Decoding Using AVX2 Instructions", SSE version). Returns the number of bytes consumed,
+ * a block is only loaded when 16 bytes are readable
+ */
+__attribute__((target("ssse3")))
+static size_t zephir_base64_encode_ssse3(unsigned char *out, const unsigned char *in, size_t length)
+{
+	const __m128i shuffle = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+	const __m128i shift_lut = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+	__m128i block, indices, result;
+	size_t i = 0;
+
+	for (; i + 16 <= length; i += 12) {
+		block = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) (in + i)), shuffle);
+
+		/* Splits every 3 bytes into four 6 bit indices, one per byte */
+		indices = _mm_or_si128(
+			_mm_mulhi_epu16(_mm_and_si128(block, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040)),
+			_mm_mullo_epi16(_mm_and_si128(block, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010))
+		);
+
+		/* Maps every index to the offset of its character class */
+		result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+		result = _mm_or_si128(result, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+		result = _mm_add_epi8(_mm_shuffle_epi8(shift_lut, result), indices);
+
+		_mm_storeu_si128((__m128i *) out, result);
+		out += 16;
+	}
+
+	return i;
+}
+
+/* Bytes of block in [from, from + count) */
+#define ZEPHIR_BASE64_RANGE(block, from, count) \
+	_mm_cmplt_epi8(_mm_add_epi8(block, _mm_set1_epi8((char) (128 - (from)))), _mm_set1_epi8((char) (-128 + (count))))
+
+/**
+ * Decodes 16 characters into 12 bytes per iteration, stops at the first block that has a character
+ * outside the alphabet (padding, whitespace) so the rest is left to php's decoder. Returns the
+ * number of characters consumed, out must have 4 bytes of room past the decoded data
+ */
+__attribute__((target("ssse3")))
+static size_t zephir_base64_decode_ssse3(unsigned char *out, const unsigned char *in, size_t length)
+{
+	const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+	__m128i block, upper, lower, digits, plus, slash, shift, values;
+	size_t i = 0;
+
+	for (; i + 16 <= length; i += 16) {
+		block = _mm_loadu_si128((const __m128i *) (in + i));
+
+		upper = ZEPHIR_BASE64_RANGE(block, 'A', 26);
+		lower = ZEPHIR_BASE64_RANGE(block, 'a', 26);
+		digits = ZEPHIR_BASE64_RANGE(block, '0', 10);
+		plus = _mm_cmpeq_epi8(block, _mm_set1_epi8('+'));
+		slash = _mm_cmpeq_epi8(block, _mm_set1_epi8('/'));
+
+		if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digits, _mm_or_si128(plus, slash)))) != 0xFFFF) {
+			break;
+		}
+
+		shift = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+		shift = _mm_or_si128(shift, _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+		shift = _mm_or_si128(shift, _mm_and_si128(digits, _mm_set1_epi8(52 - '0')));
+		shift = _mm_or_si128(shift, _mm_and_si128(plus, _mm_set1_epi8(62 - '+')));
+		shift = _mm_or_si128(shift, _mm_and_si128(slash, _mm_set1_epi8(63 - '/')));
+		values = _mm_add_epi8(block, shift);
+
+		/* Merges four 6 bit values into 24 bits and stores them big endian */
+		values = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+		values = _mm_madd_epi16(values, _mm_set1_epi32(0x00011000));
+		_mm_storeu_si128((__m128i *) out, _mm_shuffle_epi8(values, pack));
+		out += 12;
+	}
+
+	return i;
+}
+
+#endif
+
+/**
+ * Hashes str with md5, the digest is written as hexadecimal (or raw) straight into the result
+ */
+static void zephir_md5_digest(zval *return_value, zval *str, int raw_output)
 {
+	static const char hexdigits[] = "0123456789abcdef";
 	PHP_MD5_CTX ctx;
 	unsigned char digest[16];
-	char hexdigest[33];
+	zend_string *result;
 	zval copy;
-	int use_copy = 0;
+	int use_copy = 0, i;
 
 	if (Z_TYPE_P(str) != IS_STRING) {
 		use_copy = zend_make_printable_zval(str, &copy);
@@ -922,9 +1717,32 @@ void zephir_md5(zval *return_value, zval *str)
 	PHP_MD5Update(&ctx, Z_STRVAL_P(str), Z_STRLEN_P(str));
 	PHP_MD5Final(digest, &ctx);
 
-	make_digest(hexdigest, digest);
+	if (use_copy) {
+		zval_dtor(str);
+	}
+
+	if (raw_output) {
+		RETURN_STRINGL((char *) digest, 16);
+	}
+
+	result = zend_string_alloc(32, 0);
+	for (i = 0; i < 16; i++) {
+		ZSTR_VAL(result)[i * 2] = hexdigits[digest[i] >> 4];
+		ZSTR_VAL(result)[i * 2 + 1] = hexdigits[digest[i] & 0x0F];
+	}
+	ZSTR_VAL(result)[32] = '\0';
+
+	RETURN_NEW_STR(result);
+}
+
+void zephir_md5(zval *return_value, zval *str)
+{
+	zephir_md5_digest(return_value, str, 0);
+}
 
-	ZVAL_STRINGL(return_value, hexdigest, 32);
+void zephir_md5_raw(zval *return_value, zval *str)
+{
+	zephir_md5_digest(return_value, str, 1);
 }
 
 void zephir_crc32(zval *return_value, zval *str)
@@ -932,9 +1750,8 @@ void zephir_crc32(zval *return_value, zval *str)
 	zval copy;
 	int use_copy = 0;
 	size_t nr;
-	char *p;
-	php_uint32 crc;
-	php_uint32 crcinit = 0;
+	unsigned char *p;
+	uint32_t crc = 0xFFFFFFFF;
 
 	if (Z_TYPE_P(str) != IS_STRING) {
 		use_copy = zend_make_printable_zval(str, &copy);
@@ -943,10 +1760,17 @@ void zephir_crc32(zval *return_value, zval *str)
 		}
 	}
 
-	p = Z_STRVAL_P(str);
+	p = (unsigned char *) Z_STRVAL_P(str);
 	nr = Z_STRLEN_P(str);
 
-	crc = crcinit^0xFFFFFFFF;
+#ifdef ZEPHIR_X86_DISPATCH
+	if (nr >= 64 && (zephir_cpu_features() & ZEPHIR_CPU_PCLMUL)) {
+		crc = zephir_crc32_clmul(crc, p, nr & ~(size_t) 15);
+		p += nr & ~(size_t) 15;
+		nr &= 15;
+	}
+#endif
+
 	for (; nr--; ++p) {
 		crc = ((crc >> 8) & 0x00FFFFFF) ^ crc32tab[(crc ^ (*p)) & 0xFF];
 	}
@@ -958,6 +1782,127 @@ void zephir_crc32(zval *return_value, zval *str)
 	RETVAL_LONG(crc ^ 0xFFFFFFFF);
 }
 
+/**
+ * Base 64 encode
+ */
+void zephir_base64_encode(zval *return_value, zval *data)
+{
+	static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	const unsigned char *in;
+	unsigned char *out;
+	size_t length, i = 0;
+	zend_string *encoded;
+	zval copy;
+	int use_copy = 0;
+
+	if (Z_TYPE_P(data) != IS_STRING) {
+		use_copy = zend_make_printable_zval(data, &copy);
+		if (use_copy) {
+			data = &copy;
+		}
+	}
+
+	in = (const unsigned char *) Z_STRVAL_P(data);
+	length = Z_STRLEN_P(data);
+	encoded = zend_string_safe_alloc((length + 2) / 3, 4, 0, 0);
+	out = (unsigned char *) ZSTR_VAL(encoded);
+
+#ifdef ZEPHIR_X86_DISPATCH
+	if (length >= 16 && (zephir_cpu_features() & ZEPHIR_CPU_SSSE3)) {
+		i = zephir_base64_encode_ssse3(out, in, length);
+		out += i / 3 * 4;
+	}
+#endif
+
+	for (; i + 2 < length; i += 3) {
+		*out++ = alphabet[in[i] >> 2];
+		*out++ = alphabet[((in[i] & 0x03) << 4) | (in[i + 1] >> 4)];
+		*out++ = alphabet[((in[i + 1] & 0x0F) << 2) | (in[i + 2] >> 6)];
+		*out++ = alphabet[in[i + 2] & 0x3F];
+	}
+
+	if (length - i == 1) {
+		*out++ = alphabet[in[i] >> 2];
+		*out++ = alphabet[(in[i] & 0x03) << 4];
+		*out++ = '=';
+		*out++ = '=';
+	} else if (length - i == 2) {
+		*out++ = alphabet[in[i] >> 2];
+		*out++ = alphabet[((in[i] & 0x03) << 4) | (in[i + 1] >> 4)];
+		*out++ = alphabet[(in[i + 1] & 0x0F) << 2];
+		*out++ = '=';
+	}
+	*out = '\0';
+
+	if (use_copy) {
+		zval_dtor(data);
+	}
+
+	RETURN_NEW_STR(encoded);
+}
+
+/**
+ * Base 64 decode
+ */
+void zephir_base64_decode(zval *return_value, zval *data)
+{
+	const unsigned char *in;
+	size_t length, consumed = 0;
+	zend_string *decoded, *tail;
+	zval copy;
+	int use_copy = 0;
+
+	if (Z_TYPE_P(data) != IS_STRING) {
+		use_copy = zend_make_printable_zval(data, &copy);
+		if (use_copy) {
+			data = &copy;
+		}
+	}
+
+	in = (const unsigned char *) Z_STRVAL_P(data);
+	length = Z_STRLEN_P(data);
+	decoded = NULL;
+
+#ifdef ZEPHIR_X86_DISPATCH
+	if (length >= 16 && (zephir_cpu_features() & ZEPHIR_CPU_SSSE3)) {
+		decoded = zend_string_alloc(length / 4 * 3 + 16, 0);
+		consumed = zephir_base64_decode_ssse3((unsigned char *) ZSTR_VAL(decoded), in, length);
+		if (!consumed) {
+			zend_string_free(decoded);
+			decoded = NULL;
+		}
+	}
+#endif
+
+	/**
+	 * The vectorized prefix is made of whole groups of four characters of the alphabet, php's
+	 * decoder continues from the same state with the rest (padding, whitespace, invalid characters)
+	 */
+	tail = php_base64_decode_ex(in + consumed, length - consumed, 0);
+
+	if (use_copy) {
+		zval_dtor(data);
+	}
+
+	if (!tail) {
+		if (decoded) {
+			zend_string_free(decoded);
+		}
+		RETURN_FALSE;
+	}
+
+	if (!decoded) {
+		RETURN_STR(tail);
+	}
+
+	memcpy(ZSTR_VAL(decoded) + consumed / 4 * 3, ZSTR_VAL(tail), ZSTR_LEN(tail));
+	ZSTR_LEN(decoded) = consumed / 4 * 3 + ZSTR_LEN(tail);
+	ZSTR_VAL(decoded)[ZSTR_LEN(decoded)] = '\0';
+	zend_string_release(tail);
+
+	RETURN_NEW_STR(decoded);
+}
+
 void zephir_ucfirst(zval *return_value, zval *s)
 {
 	zval copy;
@@ -973,8 +1918,9 @@ void zephir_ucfirst(zval *return_value, zval *s)
 
 	if (!Z_STRLEN_P(s)) {
 		ZVAL_EMPTY_STRING(return_value);
-	}
-	else {
+	} else if (toupper((unsigned char) *Z_STRVAL_P(s)) == (unsigned char) *Z_STRVAL_P(s)) {
+		ZVAL_STR_COPY(return_value, Z_STR_P(s));
+	} else {
 		ZVAL_STRINGL(return_value, Z_STRVAL_P(s), Z_STRLEN_P(s));
 		c = Z_STRVAL_P(return_value);
 		*c = toupper((unsigned char)*c);
@@ -45,7 +45,9 @@ void zephir_fast_strpos_str(zval *return_value, const zval *haystack, char *need
 void zephir_fast_trim(zval *return_value, zval *str, zval *charlist, int where);
 void zephir_fast_str_replace(zval *return_value, zval *search, zval *replace, zval *subject);
 
+void zephir_camelize(zval *return_value, const zval *str);
 void zephir_uncamelize(zval *return_value, const zval *str);
+void zephir_camelize_cache_destroy(void);
 
 /** Starts/Ends with */
 int zephir_start_with(const zval *str, const zval *compared, zval *case_sensitive);
@@ -62,12 +64,25 @@ int zephir_json_decode(zval *return_value, zval *v, zend_bool assoc);
 void zephir_substr(zval *return_value, zval *str, long from, long length, int flags);
 
 /** Preg-Match */
+typedef struct _zephir_pcre_slot {
+	void *pce;
+	zend_string *locale;
+	struct _zephir_pcre_slot *next;
+} zephir_pcre_slot;
+
 void zephir_preg_match(zval *return_value, zval *regex, zval *subject, zval *matches, int global, long flags, long offset);
+void zephir_preg_match_cached(zval *return_value, zephir_pcre_slot *slot, zval *regex, zval *subject, zval *matches, int global, long flags, long offset);
+void zephir_preg_match_cache_destroy(void);
 
 /** Hash */
 void zephir_md5(zval *return_value, zval *str);
+void zephir_md5_raw(zval *return_value, zval *str);
 void zephir_crc32(zval *return_value, zval *str);
 
+/** Base64 */
+void zephir_base64_encode(zval *return_value, zval *data);
+void zephir_base64_decode(zval *return_value, zval *data);
+
 /** */
 void zephir_ucfirst(zval *return_value, zval *s);
 void zephir_addslashes(zval *return_value, zval *str);
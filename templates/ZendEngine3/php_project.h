@@ -36,6 +36,18 @@ ZEND_BEGIN_MODULE_GLOBALS(%PROJECT_LOWER%)
 
 	zephir_fcall_cache_entry *scache[ZEPHIR_MAX_CACHE_SLOTS];
 
+	/** Callables cache */
+	zephir_callable_cache *ccache[ZEPHIR_MAX_CALLABLE_SLOTS];
+
+	/** Class entries cache */
+	zephir_class_entry_cache cecache[ZEPHIR_MAX_CLASS_ENTRY_SLOTS];
+
+	/** in_array haystacks index */
+	zephir_in_array_cache iacache[ZEPHIR_MAX_IN_ARRAY_SLOTS];
+
+	/** camelize/uncamelize results of interned strings */
+	zephir_camelize_cache cmcache[ZEPHIR_MAX_CAMELIZE_SLOTS];
+
 	/* Cache enabled */
 	unsigned int cache_enabled;
 
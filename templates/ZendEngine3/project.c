@@ -24,11 +24,16 @@
 #include "kernel/main.h"
 #include "kernel/fcall.h"
 #include "kernel/memory.h"
+#include "kernel/object.h"
+#include "kernel/array.h"
+#include "kernel/string.h"
 
 %EXTRA_INCLUDES%
 
 %CLASS_ENTRIES%
 
+%INTERNED_STRINGS%
+
 ZEND_DECLARE_MODULE_GLOBALS(%PROJECT_LOWER%)
 
 PHP_INI_BEGIN()
@@ -53,6 +58,7 @@ static PHP_MINIT_FUNCTION(%PROJECT_LOWER%)
 	setlocale(LC_ALL, "C");
 #endif
 	REGISTER_INI_ENTRIES();
+	%INTERNED_STRINGS_INITS%
 	%CLASS_INITS%
 
 #if PHP_VERSION_ID < 50500
@@ -62,11 +68,25 @@ static PHP_MINIT_FUNCTION(%PROJECT_LOWER%)
 	return SUCCESS;
 }
 
-#ifndef ZEPHIR_RELEASE
+#if !defined(ZEPHIR_RELEASE) || defined(ZEPHIR_FCALL_PROFILE) || defined(ZTS)
 static PHP_MSHUTDOWN_FUNCTION(%PROJECT_LOWER%)
 {
+#ifdef ZEPHIR_FCALL_PROFILE
+	const char *profile_output = getenv("ZEPHIR_FCALL_PROFILE_OUTPUT");
+	const char *profile_format = getenv("ZEPHIR_FCALL_PROFILE_FORMAT");
+	FILE *profile_stream = profile_output ? fopen(profile_output, "w") : NULL;
+
+	zephir_fcall_profile_dump(profile_stream ? profile_stream : stderr, profile_format && !strcmp(profile_format, "json"));
+	if (profile_stream) {
+		fclose(profile_stream);
+	}
+	zephir_fcall_profile_shutdown();
+#endif
 
+#ifndef ZEPHIR_RELEASE
 	zephir_deinitialize_memory(TSRMLS_C);
+#endif
+	zephir_interned_strings_destroy();
 	UNREGISTER_INI_ENTRIES();
 	return SUCCESS;
 }
@@ -94,6 +114,18 @@ static void php_zephir_init_globals(zend_%PROJECT_LOWER%_globals *%PROJECT_LOWER
 	/* Static cache */
 	memset(%PROJECT_LOWER%_globals->scache, '\0', sizeof(zephir_fcall_cache_entry*) * ZEPHIR_MAX_CACHE_SLOTS);
 
+	/* Callables cache */
+	memset(%PROJECT_LOWER%_globals->ccache, '\0', sizeof(zephir_callable_cache*) * ZEPHIR_MAX_CALLABLE_SLOTS);
+
+	/* Class entries cache */
+	memset(%PROJECT_LOWER%_globals->cecache, '\0', sizeof(zephir_class_entry_cache) * ZEPHIR_MAX_CLASS_ENTRY_SLOTS);
+
+	/* in_array haystacks index */
+	memset(%PROJECT_LOWER%_globals->iacache, '\0', sizeof(zephir_in_array_cache) * ZEPHIR_MAX_IN_ARRAY_SLOTS);
+
+	/* camelize/uncamelize results */
+	memset(%PROJECT_LOWER%_globals->cmcache, '\0', sizeof(zephir_camelize_cache) * ZEPHIR_MAX_CAMELIZE_SLOTS);
+
 %INIT_GLOBALS%
 }
 
@@ -120,6 +152,11 @@ static PHP_RSHUTDOWN_FUNCTION(%PROJECT_LOWER%)
 
 	%DESTRUCTORS%
 
+	zephir_callable_cache_destroy();
+	zephir_class_entry_cache_destroy();
+	zephir_in_array_cache_destroy();
+	zephir_camelize_cache_destroy();
+	zephir_preg_match_cache_destroy();
 	zephir_deinitialize_memory(TSRMLS_C);
 	return SUCCESS;
 }
@@ -163,7 +200,7 @@ zend_module_entry %PROJECT_LOWER_SAFE%_module_entry = {
 	PHP_%PROJECT_UPPER%_EXTNAME,
 	php_%PROJECT_LOWER_SAFE%_functions,
 	PHP_MINIT(%PROJECT_LOWER%),
-#ifndef ZEPHIR_RELEASE
+#if !defined(ZEPHIR_RELEASE) || defined(ZEPHIR_FCALL_PROFILE) || defined(ZTS)
 	PHP_MSHUTDOWN(%PROJECT_LOWER%),
 #else
 	NULL,
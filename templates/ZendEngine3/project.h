@@ -4,6 +4,8 @@
 #ifndef ZEPHIR_CLASS_ENTRIES_H
 #define ZEPHIR_CLASS_ENTRIES_H
 
+%INTERNED_STRINGS%
+
 %INCLUDE_HEADERS%
 
 #endif
\ No newline at end of file
@@ -844,4 +844,59 @@ class Assign
 		let _GET["stestint2"] = 2;
 		let _GET[v] = "testval";
 	}
+
+	/**
+	 * Nested writes into a local array with long, string and variable keys,
+	 * the copy taken before the writes must be left untouched
+	 */
+	public function testArrayNestedLocal(var key, long index)
+	{
+		var arr, copy;
+
+		let arr = ["a": [1: ["x": 0]]];
+		let copy = arr;
+
+		let arr["a"][1]["x"] = 1;
+		let arr["a"][1][key] = 2;
+		let arr["a"][index]["y"] = 3;
+		let arr[key][index][key] = 4;
+		let arr[key][index][] = 5;
+		return [copy, arr];
+	}
+
+	/**
+	 * Nested writes into a property array with long, string and variable keys
+	 */
+	public function testArrayNestedProperty(var key, long index)
+	{
+		var copy;
+
+		let this->myArray = ["a": [1: ["x": 0]]];
+		let copy = this->myArray;
+
+		let this->myArray["a"][1]["x"] = 1;
+		let this->myArray["a"][1][key] = 2;
+		let this->myArray["a"][index]["y"] = 3;
+		let this->myArray[key][index][key] = 4;
+		let this->myArray[key][index][] = 5;
+		return [copy, this->myArray];
+	}
+
+	/**
+	 * Nested writes into a static property array with long, string and variable keys
+	 */
+	public function testArrayNestedStaticProperty(var key, long index)
+	{
+		var copy;
+
+		let self::testVarStatic = ["a": [1: ["x": 0]]];
+		let copy = self::testVarStatic;
+
+		let self::testVarStatic["a"][1]["x"] = 1;
+		let self::testVarStatic["a"][1][key] = 2;
+		let self::testVarStatic["a"][index]["y"] = 3;
+		let self::testVarStatic[key][index][key] = 4;
+		let self::testVarStatic[key][index][] = 5;
+		return [copy, self::testVarStatic];
+	}
 }
@@ -42,4 +42,65 @@ class Concat
 		let url .= "append" . "other" . url;
 		return url;
 	}
+
+	public function testConcatOperands(var a, var b, var c)
+	{
+		return "<" . a . "|" . b . "|" . c . ">";
+	}
+
+	public function testConcatInLoop(array items, string separator) -> string
+	{
+		var item, copy;
+		string result = "";
+		int i = 0;
+
+		for item in items {
+			if i > 0 {
+				let result .= separator;
+			}
+			let result .= item;
+			let result .= ':';
+			let result .= i;
+			let i++;
+		}
+
+		let copy = result;
+		let result .= "!";
+
+		return copy . "|" . result;
+	}
+
+	public function testConcatSelfInLoop(string seed, int times, int returnAt) -> string
+	{
+		var copy;
+		string result;
+		int i = 0;
+
+		let result = seed;
+		while i < times {
+			let result .= result;
+			let i++;
+			if i == returnAt {
+				return result;
+			}
+		}
+
+		let copy = result;
+		let result .= "!";
+
+		return copy . "|" . result;
+	}
+
+	public function testConcatStoredInLoop(array items) -> array
+	{
+		var item, stored = [];
+		string result = "";
+
+		for item in items {
+			let result .= item;
+			let stored[] = result;
+		}
+
+		return stored;
+	}
 }
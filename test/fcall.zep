@@ -127,4 +127,30 @@ class Fcall
 		let v2 = array_fill(0, 6, "?");
 		return [v1, v2];
 	}
+
+	public function testInternalMixedCase(var value)
+	{
+		return [Str_Repeat(value, 2), UCWORDS(value), Str_Pad(value, 8, "-")];
+	}
+
+	public function testDeprecatedCall()
+	{
+		return create_function("", "return 42;");
+	}
+
+	public function testCallOnNonObject(var value)
+	{
+		return value->foo();
+	}
+
+	/**
+	 * The object held by result is released by the second call, its destructor performs calls too
+	 */
+	public function testCallReleasingResult(var factory)
+	{
+		var result;
+		let result = {factory}();
+		let result = str_repeat("done", 1);
+		return result;
+	}
 }
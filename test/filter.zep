@@ -0,0 +1,35 @@
+/**
+ * Kernel filter functions, Zephir has no construct compiling to them
+ */
+
+%{
+#include "kernel/filter.h"
+}%
+
+namespace Test;
+
+class Filter
+{
+	public function alphanum(var value)
+	{
+		%{
+			zephir_filter_alphanum(return_value, value);
+		}%
+	}
+
+	public function identifier(var value)
+	{
+		%{
+			zephir_filter_identifier(return_value, value);
+		}%
+	}
+
+	public function basicCharset(var value)
+	{
+		%{
+			if (Z_TYPE_P(value) == IS_STRING) {
+				zephir_is_basic_charset(return_value, value);
+			}
+		}%
+	}
+}
@@ -52,4 +52,9 @@ class Instanceoff
 		let a = new static();
 		return a instanceof Instanceoff;
 	}
+
+	public function testInstanceOf7(var a, string className)
+	{
+		return a instanceof className;
+	}
 }
@@ -17,6 +17,12 @@ class McallDynamic
 		return this->{"method1"}() + this->{"METHOD1"}();
 	}
 
+	public function testInternedNames(var object)
+	{
+		let object->name = "interned";
+		return [object->TestMethod1(), object->method1(), object->name];
+	}
+
 	public function __call(method, arguments)
 	{
 		var realMethod;
@@ -59,6 +59,71 @@ class McallInternal
 		return a / b;
   	}
 
+	internal function h(double a, bool b, var c) -> double
+	{
+		if b {
+			return a * 2;
+		}
+		return a + (int) c;
+	}
+
+	public function i()
+	{
+		var c;
+		let c = 10;
+		return this->h(1.5, true, c) + this->h(1.5, false, c);
+	}
+
+	internal function j(bool flag, long factor = 3, string suffix = "x") -> string
+	{
+		if flag {
+			return factor . suffix;
+		}
+		return "no" . suffix;
+	}
+
+	internal function k(long! a, long b) -> long
+	{
+		return a + b;
+	}
+
+	public function l()
+	{
+		long big = 256; double half = 0.5;
+		var value, numeric;
+
+		let value = 4,
+			numeric = "12";
+
+		return [
+			this->j(big),
+			this->j(half, 2),
+			this->j(0, 5, "y"),
+			this->k(value, numeric),
+			this->k(value, "30")
+		];
+	}
+
+	private function m(long a, double b) -> double
+	{
+		return a * b;
+	}
+
+	private static function o(long a) -> long
+	{
+		return a * 2;
+	}
+
+	public function n(var value) -> double
+	{
+		long i; double total = 0;
+		for i in range(1, 3) {
+			let total += (double) this->m(i, value);
+			let total += (double) self::o(i);
+		}
+		return total;
+	}
+
   	public function callFibonacci() -> double
   	{
 		double $p = 0; long $i = 0;
@@ -640,4 +640,41 @@ class NativeArray
 		}
 		return works;
 	}
+
+	public function issetPackedIndex(var a, long index) -> boolean
+	{
+		return isset a[index];
+	}
+
+	public function fetchPackedIndex(var a, long index)
+	{
+		var value;
+
+		if fetch value, a[index] {
+			return value;
+		}
+		return "missing";
+	}
+
+	public function readPackedIndex(array a, long index)
+	{
+		return a[index];
+	}
+
+	public function readPackedKey(array a, var key)
+	{
+		return a[key];
+	}
+
+	public function updatePackedIndex(array a, long index, var value) -> array
+	{
+		let a[index] = value;
+		return a;
+	}
+
+	public function appendPacked(array a, var value) -> array
+	{
+		let a[] = value;
+		return a;
+	}
 }
@@ -7,4 +7,15 @@ class ArrayMerge
 	{
 		return array_merge(arr1, arr2);
 	}
+
+	static public function mergeRepeated(array arr1, array arr2, int times)
+	{
+		int i;
+
+		for i in range(1, times) {
+			let arr1 = array_merge(arr1, arr2);
+		}
+
+		return arr1;
+	}
 }
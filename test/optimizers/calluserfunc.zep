@@ -0,0 +1,45 @@
+
+namespace Test\Optimizers;
+
+class CallUserFunc
+{
+	protected counter = 0;
+
+	public function increment(int amount) -> int
+	{
+		let this->counter += amount;
+		return this->counter;
+	}
+
+	public function callMethods(array handlers, int times) -> int
+	{
+		var handler, result = 0;
+		int i;
+
+		for i in range(1, times) {
+			for handler in handlers {
+				let result = call_user_func_array(handler, [i]);
+			}
+		}
+
+		return result;
+	}
+
+	public function callClosure(int times) -> int
+	{
+		var closure, result = 0;
+		int i;
+
+		let closure = function(a) { return a * 2; };
+		for i in range(1, times) {
+			let result = call_user_func_array(closure, [i]);
+		}
+
+		return result;
+	}
+
+	public function callHandler(var handler)
+	{
+		return call_user_func(handler);
+	}
+}
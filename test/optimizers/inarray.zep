@@ -0,0 +1,43 @@
+
+namespace Test\Optimizers;
+
+class InArray
+{
+	public function countFound(array needles, array haystack) -> int
+	{
+		var needle;
+		int found = 0;
+
+		for needle in needles {
+			if in_array(needle, haystack) {
+				let found++;
+			}
+		}
+
+		return found;
+	}
+
+	public function addMissing(array haystack, array values) -> array
+	{
+		var value;
+
+		for value in values {
+			if !in_array(value, haystack) {
+				let haystack[] = value;
+			}
+		}
+
+		return haystack;
+	}
+
+	public function replaceAndCount(array needles, array values, var key, var value) -> array
+	{
+		var haystack, before;
+
+		let haystack = array_values(values);
+		let before = this->countFound(needles, haystack);
+		let haystack[key] = value;
+
+		return [before, this->countFound(needles, haystack)];
+	}
+}
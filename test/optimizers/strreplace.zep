@@ -37,4 +37,9 @@ class StrReplace
 
 		return preg_replace(patterns, replacements, subject);
 	}
+
+	static public function replaceLong(string search, string replace, string subject)
+	{
+		return str_replace(search, replace, subject);
+	}
 }
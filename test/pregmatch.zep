@@ -117,4 +117,27 @@ class Pregmatch
 
 		return [m1, m2];
 	}
+
+	public function testConstantPattern(var subject)
+	{
+		var matches = null;
+
+		if preg_match("/^([a-z]+)@([a-z]+)[.]com$/", subject, matches) {
+			return matches;
+		}
+
+		return false;
+	}
+
+	public function testConstantPatternAll(var subject)
+	{
+		var matches = [];
+
+		return preg_match_all("/[0-9]+/", subject, matches);
+	}
+
+	public function testConstantAlphaPattern(var subject)
+	{
+		return preg_match("/^[[:alpha:]]+$/", subject);
+	}
 }
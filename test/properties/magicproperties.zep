@@ -0,0 +1,37 @@
+
+namespace Test\Properties;
+
+class MagicProperties
+{
+	/**
+	 * This is a public property with an initial string value
+	 */
+	public someString = "test";
+
+	/**
+	 * Records the calls to the magic accessors
+	 */
+	public calls = [];
+
+	public function __get(string name)
+	{
+		let this->calls[] = "get " . name;
+		return "magic";
+	}
+
+	public function __set(string name, var value)
+	{
+		let this->calls[] = "set " . name;
+	}
+
+	public function getSomeString()
+	{
+		return this->someString;
+	}
+
+	public function setSomeString(var value)
+	{
+		let this->someString = value;
+		return this->someString;
+	}
+}
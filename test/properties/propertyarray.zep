@@ -20,4 +20,24 @@ class PropertyArray
 	{
 		let this->someArray = [1];
 	}
+
+	public function appendSome(var value)
+	{
+		let this->someArray[] = value;
+	}
+
+	public function setOtherSome(var key, var value)
+	{
+		let this->someArray[key] = value;
+	}
+
+	public function removeSome(var key)
+	{
+		unset this->someArray[key];
+	}
+
+	public function removeFrom(var object, var key)
+	{
+		unset object->someArray[key];
+	}
 }
\ No newline at end of file
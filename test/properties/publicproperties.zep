@@ -77,4 +77,17 @@ class PublicProperties
     {
 		return this->{"someTrue"};
     }
+
+	public function setSomeString(var value)
+	{
+		let this->someString = value;
+		return this->someString;
+	}
+
+	public function setDynamicProperty(string name, var value)
+	{
+		let this->{name} = value;
+		let this->someString = value;
+		return [this->{name}, this->someString];
+	}
 }
@@ -37,6 +37,48 @@ class Strings
 		return implode(glue, pieces);
 	}
 
+	public function testInternedLiteral()
+	{
+		var str, pieces;
+
+		let str = "interned literal";
+		let str .= "!";
+		let pieces = ["interned literal", "key": "interned literal"];
+		let pieces[] = str;
+
+		return pieces;
+	}
+
+	public function testCrc32(var str)
+	{
+		return crc32(str);
+	}
+
+	public function testMd5(var str)
+	{
+		return md5(str);
+	}
+
+	public function testMd5Raw(var str)
+	{
+		return md5(str, true);
+	}
+
+	public function testBase64Encode(var str)
+	{
+		return base64_encode(str);
+	}
+
+	public function testBase64Decode(var str)
+	{
+		return base64_decode(str);
+	}
+
+	public function testJoinStr(var pieces)
+	{
+		return join(", ", pieces);
+	}
+
 	public function testStrpos(var haystack, var needle)
 	{
 		return strpos(haystack, needle);
@@ -92,6 +134,41 @@ class Strings
 		return stripslashes(str);
 	}
 
+	public function testStrtolower(var str)
+	{
+		return strtolower(str);
+	}
+
+	public function testStrtoupper(var str)
+	{
+		return strtoupper(str);
+	}
+
+	public function testUcfirst(var str)
+	{
+		return ucfirst(str);
+	}
+
+	public function testUncamelize(var str)
+	{
+		return uncamelize(str);
+	}
+
+	public function testCamelize(var str)
+	{
+		return camelize(str);
+	}
+
+	public function testCamelizeLiteral()
+	{
+		var first, second;
+
+		let first = camelize("some_controller-name") . uncamelize("SomeControllerName"),
+			second = camelize("some_controller-name") . uncamelize("SomeControllerName");
+
+		return [first, second];
+	}
+
     public function testHardcodedMultilineString()
     {
         return "
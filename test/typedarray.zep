@@ -0,0 +1,61 @@
+
+/**
+ * Native typed arrays
+ */
+
+namespace Test;
+
+class TypedArray
+{
+	public function squares(int n) -> array
+	{
+		int[] a;
+		int i = 0;
+
+		while i < n {
+			let a[] = i * i;
+			let i++;
+		}
+
+		return a;
+	}
+
+	public function sum(array values) -> int
+	{
+		int[] a = values;
+		var v;
+		int total = 0;
+
+		for v in a {
+			let total += v;
+		}
+
+		return total;
+	}
+
+	public function scale(array values, double factor) -> array
+	{
+		double[] a = values;
+		int i = 0, n;
+
+		let n = count(a);
+		while i < n {
+			let a[i] = a[i] * factor;
+			let i++;
+		}
+
+		return a;
+	}
+
+	public function flags(array values) -> array
+	{
+		bool[] a;
+		var v;
+
+		for v in values {
+			let a[] = v;
+		}
+
+		return a;
+	}
+}
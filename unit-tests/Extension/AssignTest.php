@@ -99,6 +99,25 @@ class AssignTest extends \PHPUnit_Framework_TestCase
         $this->assertTrue($t->testArrayBoolExpressionAssign() == array("a" => true, "b" => false));
     }
 
+    public function testArrayNestedAssign()
+    {
+        $t = new \Test\Assign();
+
+        $original = array("a" => array(1 => array("x" => 0)));
+        $expected = array(
+            "a" => array(1 => array("x" => 1, "k" => 2), 2 => array("y" => 3)),
+            "k" => array(2 => array("k" => 4, 0 => 5))
+        );
+
+        $this->assertSame(array($original, $expected), $t->testArrayNestedLocal("k", 2));
+        $this->assertSame(array($original, $expected), $t->testArrayNestedProperty("k", 2));
+        $this->assertSame(array($original, $expected), $t->testArrayNestedStaticProperty("k", 2));
+
+        /* A numeric string variable key addresses the same slot as the long key */
+        $expected = array("a" => array(1 => array("x" => 1, 1 => 2, "y" => 3)), 1 => array(1 => array(1 => 4, 2 => 5)));
+        $this->assertSame(array($original, $expected), $t->testArrayNestedLocal("1", 1));
+    }
+
     public function testGlobalVarAssign()
     {
         $t = new \Test\Assign();
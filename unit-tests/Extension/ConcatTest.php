@@ -32,4 +32,47 @@ class ConcatTest extends \PHPUnit_Framework_TestCase
         $t->testConcatBySelfProperty(" string");
         $this->assertEquals("test string", $t->getTestProperty());
     }
+
+    public function testConcatOperands()
+    {
+        $t = new Concat();
+
+        $this->assertSame('<1|-42|str>', $t->testConcatOperands(1, -42, 'str'));
+        $this->assertSame('<' . PHP_INT_MAX . '|' . (-PHP_INT_MAX - 1) . '|>', $t->testConcatOperands(PHP_INT_MAX, -PHP_INT_MAX - 1, null));
+        $this->assertSame('<' . 1.5 . '|' . 0.1 . '|' . 1e100 . '>', $t->testConcatOperands(1.5, 0.1, 1e100));
+        $this->assertSame('<1||' . -INF . '>', $t->testConcatOperands(true, false, -INF));
+    }
+
+    public function testConcatInLoop()
+    {
+        $t = new Concat();
+
+        $items = array();
+        $expected = '';
+        for ($i = 0; $i < 1000; $i++) {
+            $items[] = str_repeat('x', $i % 7);
+            $expected .= ($i > 0 ? ', ' : '') . $items[$i] . ':' . $i;
+        }
+
+        $this->assertSame($expected . '|' . $expected . '!', $t->testConcatInLoop($items, ', '));
+        $this->assertSame('|!', $t->testConcatInLoop(array(), ', '));
+    }
+
+    public function testConcatSelfInLoop()
+    {
+        $t = new Concat();
+
+        $expected = str_repeat('ab', 1024);
+        $this->assertSame($expected . '|' . $expected . '!', $t->testConcatSelfInLoop('ab', 10, 0));
+        $this->assertSame(str_repeat('ab', 8), $t->testConcatSelfInLoop('ab', 10, 3));
+        $this->assertSame('|!', $t->testConcatSelfInLoop('', 5, 0));
+    }
+
+    public function testConcatStoredInLoop()
+    {
+        $t = new Concat();
+
+        $this->assertSame(array('a', 'ab', 'abc'), $t->testConcatStoredInLoop(array('a', 'b', 'c')));
+        $this->assertSame(array(), $t->testConcatStoredInLoop(array()));
+    }
 }
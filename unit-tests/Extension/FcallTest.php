@@ -51,6 +51,58 @@ class FcallTest extends \PHPUnit_Framework_TestCase
         $this->assertTrue($t->testArrayFill() == array(array_fill(0, 5, "?"), array_fill(0, 6, "?")));
     }
     
+    public function testInternalMixedCase()
+    {
+        $t = new \Test\Fcall();
+        $this->assertSame(array("ab cdab cd", "Ab Cd", "ab cd---"), $t->testInternalMixedCase("ab cd"));
+    }
+
+    /**
+     * Deprecated functions are called through the executor, which raises their notice
+     */
+    public function testDeprecatedCall()
+    {
+        if (PHP_VERSION_ID < 70200 || !function_exists('create_function')) {
+            $this->markTestSkipped('create_function() is only deprecated since PHP 7.2');
+        }
+
+        $t = new \Test\Fcall();
+        $deprecated = 0;
+        set_error_handler(function ($errno) use (&$deprecated) {
+            if ($errno == E_DEPRECATED) {
+                $deprecated++;
+            }
+            return true;
+        });
+        $lambda = $t->testDeprecatedCall();
+        restore_error_handler();
+
+        $this->assertSame(1, $deprecated);
+        $this->assertSame(42, $lambda());
+    }
+
+    public function testCallOnNonObject()
+    {
+        $this->setExpectedException('\RuntimeException', 'Trying to call method foo on a non-object');
+
+        $t = new \Test\Fcall();
+        $t->testCallOnNonObject(1);
+    }
+
+    public function testCallReleasingResult()
+    {
+        require_once __DIR__ . '/fixtures/FcallDestructible.php';
+
+        $t = new \Test\Fcall();
+        $destructed = new \ArrayObject();
+        $factory = function () use ($destructed) {
+            return new FcallDestructible($destructed);
+        };
+
+        $this->assertSame("done", $t->testCallReleasingResult($factory));
+        $this->assertSame(array(0), $destructed->getArrayCopy());
+    }
+
     public function testFunctionDeclaration()
     {
         $this->assertTrue(\Test\zephir_namespaced_method_test("a") == "aaaaa");
@@ -0,0 +1,96 @@
+<?php
+
+/*
+ +--------------------------------------------------------------------------+
+ | Zephir Language                                                          |
+ +--------------------------------------------------------------------------+
+ | Copyright (c) 2013-2015 Zephir Team and contributors                     |
+ +--------------------------------------------------------------------------+
+ | This source file is subject the MIT license, that is bundled with        |
+ | this package in the file LICENSE, and is available through the           |
+ | world-wide-web at the following url:                                     |
+ | http://zephir-lang.com/license.html                                      |
+ |                                                                          |
+ | If you did not receive a copy of the MIT license and are unable          |
+ | to obtain it through the world-wide-web, please send a note to           |
+ | license@zephir-lang.com so we can mail you a copy immediately.           |
+ +--------------------------------------------------------------------------+
+*/
+
+namespace Extension;
+
+use Test\Filter;
+
+class FilterTest extends \PHPUnit_Framework_TestCase
+{
+    /**
+     * Strings with a rejected byte at every position of the first three 16 byte blocks
+     */
+    protected function getBlockStrings()
+    {
+        $strings = array();
+        foreach (array(1, 15, 16, 17, 31, 32, 33, 48) as $length) {
+            for ($position = 0; $position < $length; $position++) {
+                $string = substr(str_repeat('aZ9_', 12), 0, $length);
+                $string[$position] = '-';
+                $strings[] = $string;
+            }
+        }
+        return $strings;
+    }
+
+    public function testAlphanum()
+    {
+        $t = new Filter();
+
+        $this->assertSame('', $t->alphanum(''));
+        $this->assertSame('abcXYZ019', $t->alphanum('abcXYZ019'));
+        $this->assertSame('abc1', $t->alphanum('a-b_c 1!'));
+        $this->assertSame('ab', $t->alphanum("ab\0cd"));
+        $this->assertSame('caf', $t->alphanum("caf\xC3\xA9"));
+        $this->assertSame('12345', $t->alphanum(12345));
+        $this->assertSame('15', $t->alphanum(1.5));
+
+        $bytes = '';
+        for ($i = 1; $i < 256; $i++) {
+            $bytes .= chr($i);
+        }
+        $this->assertSame('0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz', $t->alphanum($bytes));
+
+        foreach ($this->getBlockStrings() as $string) {
+            $this->assertSame(preg_replace('/[^0-9A-Za-z]/', '', $string), $t->alphanum($string));
+        }
+    }
+
+    public function testIdentifier()
+    {
+        $t = new Filter();
+
+        $this->assertSame('', $t->identifier(''));
+        $this->assertSame('some_table1', $t->identifier('some_table1'));
+        $this->assertSame('a_b1', $t->identifier('a-$_b 1!'));
+        $this->assertSame('a_', $t->identifier("a_\0b"));
+        $this->assertSame('1', $t->identifier(-1));
+        $this->assertSame(str_repeat('aZ9_', 12), $t->identifier(str_repeat('aZ9_', 12)));
+
+        $bytes = '';
+        for ($i = 1; $i < 256; $i++) {
+            $bytes .= chr($i);
+        }
+        $this->assertSame('0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ_abcdefghijklmnopqrstuvwxyz', $t->identifier($bytes));
+
+        foreach ($this->getBlockStrings() as $string) {
+            $this->assertSame(preg_replace('/[^0-9A-Za-z_]/', '', $string), $t->identifier($string));
+        }
+    }
+
+    public function testBasicCharset()
+    {
+        $t = new Filter();
+
+        $this->assertSame('ASCII', $t->basicCharset(''));
+        $this->assertFalse($t->basicCharset('abc'));
+        $this->assertFalse($t->basicCharset("\0"));
+        $this->assertNull($t->basicCharset(10));
+    }
+}
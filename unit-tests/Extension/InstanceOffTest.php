@@ -73,4 +73,15 @@ class InstanceOffTest extends \PHPUnit_Framework_TestCase
 
         $this->assertFalse($t->testInstanceOf5(new \StdClass));
     }
+
+    public function testInstanceOf7()
+    {
+        $t = new InstanceOff();
+
+        $this->assertTrue($t->testInstanceOf7($t, 'Test\InstanceOff'));
+        $this->assertTrue($t->testInstanceOf7(new \ArrayObject(), 'ArrayObject'));
+        $this->assertTrue($t->testInstanceOf7(new \ArrayObject(), 'Countable'));
+        $this->assertFalse($t->testInstanceOf7($t, 'ArrayObject'));
+        $this->assertFalse($t->testInstanceOf7(new \ArrayObject(), 'Test\InstanceOff'));
+    }
 }
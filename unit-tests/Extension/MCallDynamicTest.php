@@ -29,4 +29,11 @@ class MCallTestDynamic extends \PHPUnit_Framework_TestCase
         $this->assertEquals($a->method1(), 1);
         $this->assertEquals($a->testMagicCall1(), 2);
     }
+
+    public function testInternedNames()
+    {
+        $a = new McallDynamic;
+        $this->assertSame(array(1, 1, "interned"), $a->testInternedNames($a));
+        $this->assertSame("interned", $a->name);
+    }
 }
@@ -0,0 +1,53 @@
+<?php
+
+/*
+ +--------------------------------------------------------------------------+
+ | Zephir Language                                                          |
+ +--------------------------------------------------------------------------+
+ | Copyright (c) 2013-2015 Zephir Team and contributors                     |
+ +--------------------------------------------------------------------------+
+ | This source file is subject the MIT license, that is bundled with        |
+ | this package in the file LICENSE, and is available through the           |
+ | world-wide-web at the following url:                                     |
+ | http://zephir-lang.com/license.html                                      |
+ |                                                                          |
+ | If you did not receive a copy of the MIT license and are unable          |
+ | to obtain it through the world-wide-web, please send a note to           |
+ | license@zephir-lang.com so we can mail you a copy immediately.           |
+ +--------------------------------------------------------------------------+
+*/
+
+namespace Extension;
+
+class McallInternalTest extends \PHPUnit_Framework_TestCase
+{
+    public function testInternalCalls()
+    {
+        $t = new \Test\McallInternal();
+        $this->assertSame($t->d(), 5000005);
+        $this->assertSame($t->f(), 5000005);
+        $this->assertSame($t->g(), 1001000);
+    }
+
+    public function testTypedInternalParameters()
+    {
+        $t = new \Test\McallInternal();
+        $this->assertSame($t->i(), 14.5);
+    }
+
+    public function testInternalParameterConversions()
+    {
+        $t = new \Test\McallInternal();
+        $this->assertSame(array("3x", "2x", "noy", 16, 34), $t->l());
+    }
+
+    /**
+     * Private methods are called through their internal entry point (private-internal-methods)
+     */
+    public function testPrivateDirectCalls()
+    {
+        $t = new \Test\McallInternal();
+        $this->assertSame(15.0, $t->n(0.5));
+        $this->assertSame(24.0, $t->n("2"));
+    }
+}
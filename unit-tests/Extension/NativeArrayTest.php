@@ -166,4 +166,80 @@ class NativeArrayTest extends \PHPUnit_Framework_TestCase
         $t = new NativeArray();
         $this->assertTrue($t->Issue709());
     }
+
+    public function testPackedArrayHoles()
+    {
+        $t = new NativeArray();
+
+        $a = array(1, 2, 3);
+        unset($a[1]);
+
+        $this->assertFalse($t->issetPackedIndex($a, 1));
+        $this->assertTrue($t->issetPackedIndex($a, 2));
+        $this->assertSame("missing", $t->fetchPackedIndex($a, 1));
+        $this->assertSame(3, $t->fetchPackedIndex($a, 2));
+        $this->assertSame(3, $t->readPackedIndex($a, 2));
+        $this->assertSame(1, $t->readPackedKey($a, 0));
+
+        /* Filling a hole must keep the insertion order like PHP does */
+        $this->assertSame(array(0 => 1, 2 => 3, 1 => 9), $t->updatePackedIndex($a, 1, 9));
+        $this->assertSame(array(0 => 1, 2 => 3, 3 => 4), $t->appendPacked($a, 4));
+        $this->assertSame(array(0 => 1, 2 => 3), $a);
+
+        /* Removing the last element leaves the next free element past the used buckets */
+        $a = array(1, 2, 3);
+        unset($a[2]);
+
+        $this->assertFalse($t->issetPackedIndex($a, 2));
+        $this->assertSame("missing", $t->fetchPackedIndex($a, 2));
+        $this->assertSame(array(0 => 1, 1 => 2, 3 => 4), $t->appendPacked($a, 4));
+        $this->assertSame(array(1, 2, 9), $t->updatePackedIndex($a, 2, 9));
+    }
+
+    public function testPackedArrayOutOfRange()
+    {
+        $t = new NativeArray();
+        $a = array(1, 2, 3);
+
+        $this->assertFalse($t->issetPackedIndex($a, 3));
+        $this->assertFalse($t->issetPackedIndex($a, 100));
+        $this->assertFalse($t->issetPackedIndex($a, -1));
+        $this->assertSame("missing", $t->fetchPackedIndex($a, 3));
+        $this->assertSame("missing", $t->fetchPackedIndex($a, -1));
+
+        $this->assertSame(array(1, 2, 3, 4), $t->updatePackedIndex($a, 3, 4));
+        $this->assertSame(array(0 => 1, 1 => 2, 2 => 3, 10 => 4), $t->updatePackedIndex($a, 10, 4));
+        $this->assertSame(array(0 => 1, 1 => 2, 2 => 3, -1 => 4), $t->updatePackedIndex($a, -1, 4));
+        $this->assertSame(array(1, 2, 3, 4), $t->appendPacked($a, 4));
+        $this->assertSame(array(1, 2, 3), $a);
+
+        /* Appending to a full table has to grow it */
+        $a = range(0, 7);
+        $this->assertSame(range(0, 8), $t->appendPacked($a, 8));
+        $this->assertSame(range(0, 8), $t->updatePackedIndex($a, 8, 8));
+    }
+
+    public function testPackedArrayConvertedToHash()
+    {
+        $t = new NativeArray();
+
+        $a = array(1, 2);
+        $a["key"] = "value";
+
+        $this->assertTrue($t->issetPackedIndex($a, 1));
+        $this->assertFalse($t->issetPackedIndex($a, 2));
+        $this->assertSame(2, $t->fetchPackedIndex($a, 1));
+        $this->assertSame(2, $t->readPackedIndex($a, 1));
+        $this->assertSame("value", $t->readPackedKey($a, "key"));
+        $this->assertSame(array(0 => 5, 1 => 2, "key" => "value"), $t->updatePackedIndex($a, 0, 5));
+        $this->assertSame(array(0 => 1, 1 => 2, "key" => "value", 2 => 3), $t->appendPacked($a, 3));
+
+        /* Numeric string keys read the packed buckets */
+        $a = array(1, 2);
+        $b = $t->updatePackedIndex($a, 2, 3);
+        $this->assertSame(array(1, 2, 3), $b);
+        $this->assertSame(3, $t->readPackedKey($b, "2"));
+        $this->assertSame(array(1, 2, 3, 4), $t->appendPacked($b, 4));
+        $this->assertSame(array(1, 2), $a);
+    }
 }
@@ -28,4 +28,41 @@ class ArrayMergeTest extends \PHPUnit_Framework_TestCase
         $this->assertSame(array(1, 2, 3), ArrayMerge::mergeTwoRequiredArrays(array(1, 2, 3), array()));
         $this->assertSame(array(1, 2, 3), ArrayMerge::mergeTwoRequiredArrays(array(), array(1, 2, 3)));
     }
+
+    public function testMergeRepeated()
+    {
+        $list = array(1, 2);
+        $this->assertSame(array(1, 2, 3, 4, 3, 4), ArrayMerge::mergeRepeated($list, array(3, 4), 2));
+        $this->assertSame(array(1, 2), $list);
+
+        $config = array('a' => 1, 'b' => 2);
+        $this->assertSame(array('a' => 3, 'b' => 2, 0 => 5, 1 => 5), ArrayMerge::mergeRepeated($config, array('a' => 3, 5), 2));
+        $this->assertSame(array('a' => 1, 'b' => 2), $config);
+
+        $sparse = array(5 => 'x', 'k' => 'y', 2 => 'z');
+        $this->assertSame(array(0 => 'x', 'k' => 'y', 1 => 'z', 2 => 'w'), ArrayMerge::mergeRepeated($sparse, array('w'), 1));
+    }
+
+    public function testMergeRepeatedKeyLayouts()
+    {
+        $holes = array(1, 2, 3);
+        unset($holes[1]);
+        $this->assertSame(array(1, 3, 4), ArrayMerge::mergeRepeated($holes, array(4), 1));
+
+        $trailing = array(1, 2, 3);
+        unset($trailing[2]);
+        $this->assertSame(array(1, 2, 4), ArrayMerge::mergeRepeated($trailing, array(4), 1));
+
+        $negative = array(-5 => 'x', 'k' => 'y');
+        $this->assertSame(array(0 => 'x', 'k' => 'y', 1 => 'z'), ArrayMerge::mergeRepeated($negative, array('z'), 1));
+
+        $reversed = array(1 => 'a', 0 => 'b');
+        $this->assertSame(array('a', 'b', 'c'), ArrayMerge::mergeRepeated($reversed, array('c'), 1));
+
+        $ordered = array('k' => 'v', 0 => 'a', 1 => 'b');
+        $this->assertSame(array('k' => 'v', 0 => 'a', 1 => 'b', 2 => 'c'), ArrayMerge::mergeRepeated($ordered, array('c'), 1));
+
+        $strings = array('a' => 1, 'b' => 2);
+        $this->assertSame(array('a' => 1, 'b' => 3, 0 => 4), ArrayMerge::mergeRepeated($strings, array('b' => 3, 4), 1));
+    }
 }
@@ -0,0 +1,44 @@
+<?php
+/*
+ +--------------------------------------------------------------------------+
+ | Zephir Language                                                          |
+ +--------------------------------------------------------------------------+
+ | Copyright (c) 2013-2015 Zephir Team and contributors                     |
+ +--------------------------------------------------------------------------+
+ | This source file is subject the MIT license, that is bundled with        |
+ | this package in the file LICENSE, and is available through the           |
+ | world-wide-web at the following url:                                     |
+ | http://zephir-lang.com/license.html                                      |
+ |                                                                          |
+ | If you did not receive a copy of the MIT license and are unable          |
+ | to obtain it through the world-wide-web, please send a note to           |
+ | license@zephir-lang.com so we can mail you a copy immediately.           |
+ +--------------------------------------------------------------------------+
+*/
+
+namespace Extension\Optimizers;
+
+use Test\Optimizers\CallUserFunc;
+
+class CallUserFuncTest extends \PHPUnit_Framework_TestCase
+{
+    public function testPolymorphicMethods()
+    {
+        $a = new CallUserFunc();
+        $b = new CallUserFunc();
+
+        $this->assertSame(15, $a->callMethods(array(array($a, 'increment')), 5));
+        $this->assertSame(30, $a->callMethods(array(array($b, 'increment'), array($a, 'increment')), 5));
+    }
+
+    public function testClosures()
+    {
+        $test = new CallUserFunc();
+
+        $this->assertSame(20, $test->callClosure(10));
+        $this->assertSame(7, $test->callHandler(function () {
+            return 7;
+        }));
+        $this->assertSame(3, $test->callHandler(array(new \ArrayObject(array(1, 2, 3)), 'count')));
+    }
+}
@@ -0,0 +1,91 @@
+<?php
+/*
+ +--------------------------------------------------------------------------+
+ | Zephir Language                                                          |
+ +--------------------------------------------------------------------------+
+ | Copyright (c) 2013-2015 Zephir Team and contributors                     |
+ +--------------------------------------------------------------------------+
+ | This source file is subject the MIT license, that is bundled with        |
+ | this package in the file LICENSE, and is available through the           |
+ | world-wide-web at the following url:                                     |
+ | http://zephir-lang.com/license.html                                      |
+ |                                                                          |
+ | If you did not receive a copy of the MIT license and are unable          |
+ | to obtain it through the world-wide-web, please send a note to           |
+ | license@zephir-lang.com so we can mail you a copy immediately.           |
+ +--------------------------------------------------------------------------+
+*/
+
+namespace Extension\Optimizers;
+
+use Test\Optimizers\InArray;
+
+class InArrayTest extends \PHPUnit_Framework_TestCase
+{
+    protected function countFound(array $needles, array $haystack)
+    {
+        $found = 0;
+        foreach ($needles as $needle) {
+            if (in_array($needle, $haystack)) {
+                $found++;
+            }
+        }
+        return $found;
+    }
+
+    public function testStringHaystack()
+    {
+        $t = new InArray();
+
+        $haystack = array();
+        for ($i = 0; $i < 32; $i++) {
+            $haystack[] = 'item' . $i;
+        }
+        $haystack[] = '10';
+
+        $needles = array('item0', 'item31', 'item32', 'ITEM1', '', '10', '1e1', 10, 0, null);
+        for ($i = 0; $i < 8; $i++) {
+            $this->assertSame($this->countFound($needles, $haystack), $t->countFound($needles, $haystack));
+        }
+
+        $haystack[3] = 'item32';
+        $this->assertSame($this->countFound($needles, $haystack), $t->countFound($needles, $haystack));
+    }
+
+    public function testLongHaystack()
+    {
+        $t = new InArray();
+
+        $haystack = range(0, 63);
+        $needles = array(5, 63, 64, -1, '5', 5.0, 'abc', true);
+        for ($i = 0; $i < 8; $i++) {
+            $this->assertSame($this->countFound($needles, $haystack), $t->countFound($needles, $haystack));
+        }
+
+        $haystack[] = 'abc';
+        $this->assertSame($this->countFound($needles, $haystack), $t->countFound($needles, $haystack));
+
+        unset($haystack[5]);
+        $this->assertSame($this->countFound($needles, $haystack), $t->countFound($needles, $haystack));
+    }
+
+    public function testKernelWritesToIndexedHaystack()
+    {
+        $t = new InArray();
+
+        $values = array();
+        for ($i = 0; $i < 32; $i++) {
+            $values[] = 'item' . $i;
+        }
+        $needles = array_merge($values, array('item32', 'other'));
+
+        $this->assertSame(array(32, 31), $t->replaceAndCount($needles, $values, 0, 'none'));
+        $this->assertSame(array(32, 33), $t->replaceAndCount($needles, $values, 32, 'item32'));
+        $this->assertSame(array(32, 32), $t->replaceAndCount($needles, $values, 'key', 'item0'));
+
+        $haystack = range(0, 31);
+        $values = array_merge(range(0, 63), range(16, 80));
+        $this->assertSame(range(0, 80), $t->addMissing($haystack, $values));
+        $this->assertSame(range(0, 31), $haystack);
+    }
+}
@@ -37,4 +37,15 @@ class StrReplaceTest extends \PHPUnit_Framework_TestCase
         $this->assertEquals(StrReplace::issue732A(), "F");
         $this->assertEquals(StrReplace::issue732B(), "The slow black bear jumped over the lazy dog.");
     }
+
+    public function testReplaceLong()
+    {
+        $subject = str_repeat('lorem ipsum dolor sit amet ', 16) . 'ipsum';
+
+        $this->assertEquals(str_replace('ipsum', 'X', $subject), StrReplace::replaceLong('ipsum', 'X', $subject));
+        $this->assertEquals(str_replace('ipsum', 'IPSUM!!', $subject), StrReplace::replaceLong('ipsum', 'IPSUM!!', $subject));
+        $this->assertEquals(str_replace('or', '', $subject), StrReplace::replaceLong('or', '', $subject));
+        $this->assertEquals($subject, StrReplace::replaceLong('absent', 'X', $subject));
+        $this->assertEquals('', StrReplace::replaceLong('ipsum', 'X', ''));
+    }
 }
@@ -84,4 +84,39 @@ class PregmatchTest extends \PHPUnit_Framework_TestCase
         $this->assertEquals($arr[0], array(array('test1', 'test2'), array('test1', 'test2')));
         $this->assertEquals($arr[1], array(array('test1', 'test1'), array('test2', 'test2')));
     }
+
+    public function testConstantPattern()
+    {
+        $t = new Pregmatch;
+
+        for ($i = 0; $i < 3; $i++) {
+            $this->assertSame(array('user@example.com', 'user', 'example'), $t->testConstantPattern('user@example.com'));
+            $this->assertSame(array('admin@host.com', 'admin', 'host'), $t->testConstantPattern('admin@host.com'));
+            $this->assertFalse($t->testConstantPattern('not an address'));
+            $this->assertFalse($t->testConstantPattern(42));
+        }
+
+        $this->assertSame(3, $t->testConstantPatternAll('1, 22 and 333'));
+        $this->assertSame(2, $t->testConstantPatternAll(1.5));
+        $this->assertSame(0, $t->testConstantPatternAll('none'));
+    }
+
+    public function testConstantPatternFollowsLocale()
+    {
+        $t = new Pregmatch;
+
+        $this->assertSame(0, $t->testConstantAlphaPattern("caf\xE9"));
+
+        $locale = setlocale(LC_CTYPE, 'fr_FR.ISO8859-1', 'fr_FR.ISO-8859-1', 'de_DE.ISO8859-1', 'de_DE.ISO-8859-1');
+        if ($locale === false) {
+            $this->markTestSkipped('No ISO-8859-1 locale is available');
+        }
+
+        $expected = preg_match('/^[[:alpha:]]+$/', "caf\xE9");
+        $result = $t->testConstantAlphaPattern("caf\xE9");
+        setlocale(LC_CTYPE, 'C');
+
+        $this->assertSame($expected, $result);
+        $this->assertSame(0, $t->testConstantAlphaPattern("caf\xE9"));
+    }
 }
@@ -0,0 +1,47 @@
+<?php
+
+/*
+ +--------------------------------------------------------------------------+
+ | Zephir Language                                                          |
+ +--------------------------------------------------------------------------+
+ | Copyright (c) 2013-2015 Zephir Team and contributors                     |
+ +--------------------------------------------------------------------------+
+ | This source file is subject the MIT license, that is bundled with        |
+ | this package in the file LICENSE, and is available through the           |
+ | world-wide-web at the following url:                                     |
+ | http://zephir-lang.com/license.html                                      |
+ |                                                                          |
+ | If you did not receive a copy of the MIT license and are unable          |
+ | to obtain it through the world-wide-web, please send a note to           |
+ | license@zephir-lang.com so we can mail you a copy immediately.           |
+ +--------------------------------------------------------------------------+
+*/
+
+namespace Extension\Properties;
+
+use Test\Properties\MagicProperties;
+
+class MagicPropertiesTest extends \PHPUnit_Framework_TestCase
+{
+    public function testOffsetAccess()
+    {
+        $t = new MagicProperties();
+
+        $this->assertSame("test", $t->getSomeString());
+        $this->assertSame("foo", $t->setSomeString("foo"));
+        $this->assertSame("foo", $t->someString);
+        $this->assertSame(array(), $t->calls);
+    }
+
+    public function testUnsetPropertyUsesMagicAccessors()
+    {
+        $t = new MagicProperties();
+        unset($t->someString);
+
+        $this->assertSame("magic", $t->getSomeString());
+        $this->assertSame(array("get someString"), $t->calls);
+
+        $this->assertSame("magic", $t->setSomeString("foo"));
+        $this->assertSame(array("get someString", "set someString", "get someString"), $t->calls);
+    }
+}
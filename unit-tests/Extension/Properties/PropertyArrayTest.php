@@ -28,4 +28,58 @@ class PropertyArrayTest extends \PHPUnit_Framework_TestCase
         $t = new PropertyArray();
         $this->assertSame(array(1), $t->someArray);
     }
+
+    public function testUpdateInPlace()
+    {
+        $t = new PropertyArray();
+        $copy = $t->someArray;
+
+        $t->appendSome('one');
+        $t->setOtherSome('two', 2);
+        $this->assertSame(array(1), $copy);
+        $this->assertSame(array(1, 'one', 'two' => 2), $t->someArray);
+
+        $t->removeSome(0);
+        $this->assertSame(array(1 => 'one', 'two' => 2), $t->someArray);
+
+        $t->someArray = null;
+        $t->appendSome(3);
+        $this->assertSame(array(3), $t->someArray);
+    }
+
+    public function testUnsetIndex()
+    {
+        $t = new PropertyArray();
+        $t->setOtherSome('two', 2);
+
+        $t->removeSome('two');
+        $this->assertTrue(isset($t->someArray));
+        $this->assertSame(array(1), $t->someArray);
+
+        $t->someArray = null;
+        $t->removeSome(0);
+        $this->assertFalse(isset($t->someArray));
+        $this->assertTrue(array_key_exists('someArray', get_object_vars($t)));
+        $this->assertNull($t->someArray);
+    }
+
+    public function testUnsetIndexDoesNotCreateProperty()
+    {
+        $t = new PropertyArray();
+
+        unset($t->someArray);
+        $t->removeSome(0);
+        $this->assertFalse(isset($t->someArray));
+        $this->assertFalse(array_key_exists('someArray', get_object_vars($t)));
+
+        $object = new \stdClass();
+        $t->removeFrom($object, 0);
+        $this->assertFalse(isset($object->someArray));
+        $this->assertFalse(property_exists($object, 'someArray'));
+
+        $object->someArray = array(1, 2);
+        $t->removeFrom($object, 0);
+        $this->assertTrue(property_exists($object, 'someArray'));
+        $this->assertSame(array(1 => 2), $object->someArray);
+    }
 }
@@ -54,4 +54,52 @@ class PublicPropertiesTest extends \PHPUnit_Framework_TestCase
         $t = new ExtendsPublicProperties();
         $this->assertEquals($t->getSomeGetterSetterArray(), array("holy"));
     }
+
+    public function testOffsetWrite()
+    {
+        $t = new PublicProperties();
+
+        $this->assertSame("foo", $t->setSomeString("foo"));
+        $this->assertSame("foo", $t->someString);
+
+        $value = array(1, 2);
+        $this->assertSame(array(1, 2), $t->setSomeString($value));
+        $value[] = 3;
+        $this->assertSame(array(1, 2), $t->someString);
+
+        $this->assertSame(array(1, 2), $t->setSomeString($t->someString));
+    }
+
+    public function testOffsetWriteThroughReference()
+    {
+        $t = new PublicProperties();
+        $reference = &$t->someString;
+
+        $t->setSomeString("foo");
+        $this->assertSame("foo", $reference);
+
+        $reference = "bar";
+        $this->assertSame("bar", $t->someString);
+    }
+
+    public function testOffsetWriteAfterUnset()
+    {
+        $t = new PublicProperties();
+        unset($t->someString);
+
+        $this->assertSame("foo", $t->setSomeString("foo"));
+        $this->assertSame("foo", $t->someString);
+    }
+
+    public function testOffsetWriteWithDynamicProperties()
+    {
+        $t = new PublicProperties();
+
+        $this->assertSame(array("foo", "foo"), $t->setDynamicProperty("someDynamic", "foo"));
+        $this->assertTrue(property_exists($t, "someDynamic"));
+        $this->assertSame("foo", $t->someDynamic);
+
+        $this->assertSame(array("bar", "bar"), $t->setDynamicProperty("someString", "bar"));
+        $this->assertSame("bar", $t->someString);
+    }
 }
@@ -54,6 +54,58 @@ class StringTest extends \PHPUnit_Framework_TestCase
         $this->assertTrue($t->testRtrim2Params('Hello World', "Hdle") == "Hello Wor");
     }
 
+    public function testTrimDefaultCharlist()
+    {
+        $t = new \Test\Strings();
+
+        $this->assertSame("hello", $t->testTrim("hello"));
+        $this->assertSame("hello", $t->testTrim(" \t\n\r\0\x0Bhello \t\n\r\0\x0B"));
+        $this->assertSame("\fhello\f", $t->testTrim("\fhello\f"));
+        $this->assertSame("", $t->testTrim(" \t "));
+        $this->assertSame("hello \n", $t->testLtrim("\n hello \n"));
+        $this->assertSame("\n hello", $t->testRtrim("\n hello \n"));
+        $this->assertSame("12", $t->testTrim(12));
+    }
+
+    public function testCaseConversion()
+    {
+        $t = new \Test\Strings();
+
+        $long = str_repeat('Zephir-Router/SEGMENT_', 10);
+        foreach (array('', 'already lower', 'MiXeD cAsE @[`{', $long, "caf\xC3\xA9 NO\xC3\x8BL") as $str) {
+            $this->assertSame(strtolower($str), $t->testStrtolower($str));
+            $this->assertSame(strtoupper($str), $t->testStrtoupper($str));
+            $this->assertSame(ucfirst($str), $t->testUcfirst($str));
+        }
+
+        $this->assertSame("123", $t->testStrtolower(123));
+    }
+
+    public function testUncamelize()
+    {
+        $t = new \Test\Strings();
+
+        $this->assertSame("already_uncamelized", $t->testUncamelize("already_uncamelized"));
+        $this->assertSame("camel_case", $t->testUncamelize("CamelCase"));
+        $this->assertSame("some_long_controller_name_for_the_router", $t->testUncamelize("someLongControllerNameForTheRouter"));
+        $this->assertSame("a_b_c", $t->testUncamelize("ABC"));
+    }
+
+    public function testCamelize()
+    {
+        $t = new \Test\Strings();
+
+        $this->assertSame("FooBar", $t->testCamelize("foo_bar"));
+        $this->assertSame("FooBar", $t->testCamelize("-foo-bar-"));
+        $this->assertSame("FooBarBaz", $t->testCamelize("FOO_BAR_baz"));
+        $this->assertSame("A_b", $t->testCamelize("a__b"));
+        $this->assertSame("", $t->testCamelize("__"));
+        $this->assertSame(
+            array("SomeControllerNamesome_controller_name", "SomeControllerNamesome_controller_name"),
+            $t->testCamelizeLiteral()
+        );
+    }
+
     public function testStrpos()
     {
         $t = new \Test\Strings();
@@ -70,6 +122,56 @@ class StringTest extends \PHPUnit_Framework_TestCase
         assert($t->testImplode(",", $pieces) == "a,b,c");
     }
 
+    public function testInternedLiteral()
+    {
+        $t = new \Test\Strings();
+
+        $expected = array(0 => "interned literal", "key" => "interned literal", 1 => "interned literal!");
+        $this->assertSame($expected, $t->testInternedLiteral());
+        $this->assertSame($expected, $t->testInternedLiteral());
+    }
+
+    public function testHashes()
+    {
+        $t = new \Test\Strings();
+
+        foreach (array(0, 1, 15, 16, 63, 64, 65, 127, 200, 1031) as $length) {
+            $str = substr(str_repeat(md5($length, true) . "\0\xff cache-key", 80), 0, $length);
+            $this->assertSame(crc32($str), $t->testCrc32($str));
+            $this->assertSame(md5($str), $t->testMd5($str));
+            $this->assertSame(md5($str, true), $t->testMd5Raw($str));
+        }
+
+        $this->assertSame(crc32("123"), $t->testCrc32(123));
+    }
+
+    public function testBase64()
+    {
+        $t = new \Test\Strings();
+
+        foreach (array(0, 1, 2, 3, 11, 12, 13, 16, 47, 48, 100, 1000) as $length) {
+            $str = substr(str_repeat(md5($length, true) . "\0\xfe\xff etag", 80), 0, $length);
+            $encoded = base64_encode($str);
+            $this->assertSame($encoded, $t->testBase64Encode($str));
+            $this->assertSame($str, $t->testBase64Decode($encoded));
+            $this->assertSame(base64_decode(chunk_split($encoded, 20)), $t->testBase64Decode(chunk_split($encoded, 20)));
+        }
+
+        $this->assertSame(base64_decode("QUJDREVGR0hJSktMTU5PUFFS*U1RVVldY"), $t->testBase64Decode("QUJDREVGR0hJSktMTU5PUFFS*U1RVVldY"));
+        $this->assertSame(base64_decode("QUJDREVGR0hJSktMTU5PUFFSU1RVVldYWQ"), $t->testBase64Decode("QUJDREVGR0hJSktMTU5PUFFSU1RVVldYWQ"));
+    }
+
+    public function testJoinMixedPieces()
+    {
+        $t = new \Test\Strings();
+
+        $pieces = array("a", 0, -7, PHP_INT_MAX, ~PHP_INT_MAX, 9, 10, 1.5, null, true, "");
+        $this->assertSame(implode(", ", $pieces), $t->testJoinStr($pieces));
+        $this->assertSame(implode("--", $pieces), $t->testImplode("--", $pieces));
+        $this->assertSame("", $t->testJoinStr(array()));
+        $this->assertSame("42", $t->testJoinStr(array(42)));
+    }
+
     public function testExplode()
     {
         $t = new \Test\Strings();
@@ -89,6 +191,22 @@ class StringTest extends \PHPUnit_Framework_TestCase
         $this->assertTrue($ar3[2] == "piece3,piece4,piece5,piece6");
     }
 
+    public function testExplodeEdgeCases()
+    {
+        $t = new \Test\Strings();
+
+        $path = str_repeat("segment,a,,", 12) . "end";
+        $this->assertSame(explode(",", $path), $t->testExplodeStr($path));
+        $this->assertSame(explode("::", "a::b::::c"), $t->testExplode("::", "a::b::::c"));
+        $this->assertSame(array("no delimiter"), $t->testExplodeStr("no delimiter"));
+        $this->assertSame(array(""), $t->testExplodeStr(""));
+
+        foreach (array(-20, -3, -1, 0, 1, 2, 20) as $limit) {
+            $this->assertSame(explode(",", $path, $limit), $t->testExplodeLimit($path, $limit));
+            $this->assertSame(explode(",", "", $limit), $t->testExplodeLimit("", $limit));
+        }
+    }
+
     public function testSubstr()
     {
         $t = new \Test\Strings();
@@ -0,0 +1,58 @@
+<?php
+/*
+ +--------------------------------------------------------------------------+
+ | Zephir Language                                                          |
+ +--------------------------------------------------------------------------+
+ | Copyright (c) 2013-2015 Zephir Team and contributors                     |
+ +--------------------------------------------------------------------------+
+ | This source file is subject the MIT license, that is bundled with        |
+ | this package in the file LICENSE, and is available through the           |
+ | world-wide-web at the following url:                                     |
+ | http://zephir-lang.com/license.html                                      |
+ |                                                                          |
+ | If you did not receive a copy of the MIT license and are unable          |
+ | to obtain it through the world-wide-web, please send a note to           |
+ | license@zephir-lang.com so we can mail you a copy immediately.           |
+ +--------------------------------------------------------------------------+
+*/
+
+namespace Extension;
+
+use Test\TypedArray;
+
+class TypedArrayTest extends \PHPUnit_Framework_TestCase
+{
+    public function testAppend()
+    {
+        $t = new TypedArray();
+
+        $this->assertSame(array(), $t->squares(0));
+        $this->assertSame(array(0, 1, 4, 9, 16), $t->squares(5));
+        $squares = $t->squares(100);
+        $this->assertSame(99 * 99, end($squares));
+    }
+
+    public function testTraverse()
+    {
+        $t = new TypedArray();
+
+        $this->assertSame(0, $t->sum(array()));
+        $this->assertSame(15, $t->sum(array(1, 2, 3, 4, 5)));
+        $this->assertSame(6, $t->sum(array('a' => 1, 'b' => 2, 'c' => 3)));
+    }
+
+    public function testIndex()
+    {
+        $t = new TypedArray();
+
+        $this->assertSame(array(2.0, 5.0, 7.0), $t->scale(array(1.0, 2.5, 3.5), 2.0));
+        $this->assertSame(array(), $t->scale(array(), 2.0));
+    }
+
+    public function testBool()
+    {
+        $t = new TypedArray();
+
+        $this->assertSame(array(true, false, true), $t->flags(array(true, false, true)));
+    }
+}
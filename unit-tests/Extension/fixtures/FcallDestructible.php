@@ -0,0 +1,39 @@
+<?php
+
+/*
+ +--------------------------------------------------------------------------+
+ | Zephir Language                                                          |
+ +--------------------------------------------------------------------------+
+ | Copyright (c) 2013-2015 Zephir Team and contributors                     |
+ +--------------------------------------------------------------------------+
+ | This source file is subject the MIT license, that is bundled with        |
+ | this package in the file LICENSE, and is available through the           |
+ | world-wide-web at the following url:                                     |
+ | http://zephir-lang.com/license.html                                      |
+ |                                                                          |
+ | If you did not receive a copy of the MIT license and are unable          |
+ | to obtain it through the world-wide-web, please send a note to           |
+ | license@zephir-lang.com so we can mail you a copy immediately.           |
+ +--------------------------------------------------------------------------+
+*/
+
+namespace Extension;
+
+/**
+ * Performs a call from its destructor
+ */
+class FcallDestructible
+{
+    protected $destructed;
+
+    public function __construct(\ArrayObject $destructed)
+    {
+        $this->destructed = $destructed;
+    }
+
+    public function __destruct()
+    {
+        $t = new \Test\Fcall();
+        $this->destructed[] = $t->testCall1();
+    }
+}
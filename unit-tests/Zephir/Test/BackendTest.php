@@ -0,0 +1,101 @@
+<?php
+
+/*
+ +--------------------------------------------------------------------------+
+ | Zephir Language                                                          |
+ +--------------------------------------------------------------------------+
+ | Copyright (c) 2013-2015 Zephir Team and contributors                     |
+ +--------------------------------------------------------------------------+
+ | This source file is subject the MIT license, that is bundled with        |
+ | this package in the file LICENSE, and is available through the           |
+ | world-wide-web at the following url:                                     |
+ | http://zephir-lang.com/license.html                                      |
+ |                                                                          |
+ | If you did not receive a copy of the MIT license and are unable          |
+ | to obtain it through the world-wide-web, please send a note to           |
+ | license@zephir-lang.com so we can mail you a copy immediately.           |
+ +--------------------------------------------------------------------------+
+*/
+
+namespace Zephir\Test;
+
+use Zephir\CodePrinter;
+use Zephir\CompilationContext;
+use Zephir\Variable;
+use Zephir\Backends\ZendEngine3\Backend as ZendEngine3Backend;
+use Zephir\Backends\ZendEngine3\StringsManager as ZendEngine3StringsManager;
+
+class BackendTest extends \PHPUnit_Framework_TestCase
+{
+    protected function createContext()
+    {
+        $context = new CompilationContext();
+        $context->backend = new ZendEngine3Backend();
+        $context->codePrinter = new CodePrinter();
+        $context->stringsManager = new ZendEngine3StringsManager();
+        return $context;
+    }
+
+    public function testMethodCallUsesInternedName()
+    {
+        $context = $this->createContext();
+        $context->backend->callMethod(new Variable('variable', 'result', null), new Variable('variable', 'object', null), 'getname', '&_0, 0', null, $context);
+
+        $this->assertEquals('ZEPHIR_CALL_METHOD_STR(&result, &object, zephir_interned_getname, &_0, 0);', trim($context->codePrinter->getOutput()));
+        $this->assertEquals(array('getname'), $context->stringsManager->getInternedStrings());
+    }
+
+    public function testPropertyReadUsesInternedName()
+    {
+        $context = $this->createContext();
+        $context->backend->fetchProperty(new Variable('variable', 'result', null), new Variable('variable', 'object', null), 'name', false, $context);
+
+        $this->assertEquals('zephir_read_property_str(&result, &object, zephir_interned_name, PH_NOISY_CC);', trim($context->codePrinter->getOutput()));
+        $this->assertEquals(array('name'), $context->stringsManager->getInternedStrings());
+    }
+
+    public function testNamesThatAreNotIdentifiersAreNotInterned()
+    {
+        $context = $this->createContext();
+        $context->backend->callMethod(null, new Variable('variable', 'object', null), 'some-method', '&_0, 0', null, $context);
+
+        $this->assertEquals('ZEPHIR_CALL_METHOD(NULL, &object, "some-method", &_0, 0);', trim($context->codePrinter->getOutput()));
+        $this->assertEquals(array(), $context->stringsManager->getInternedStrings());
+    }
+
+    public function testOnlyStringsNotOtherwiseUsedInLoopsGrow()
+    {
+        $context = $this->createContext();
+        $loop = array(
+            'type' => 'while',
+            'expr' => array('type' => 'variable', 'value' => 'running'),
+            'statements' => array(
+                array(
+                    'type' => 'let',
+                    'assignments' => array(
+                        array('assign-type' => 'variable', 'operator' => 'concat-assign', 'variable' => 'built', 'expr' => array('type' => 'variable', 'value' => 'item')),
+                        array('assign-type' => 'variable', 'operator' => 'concat-assign', 'variable' => 'stored', 'expr' => array('type' => 'string', 'value' => 'x')),
+                        array('assign-type' => 'variable-append', 'operator' => 'assign', 'variable' => 'items', 'expr' => array('type' => 'variable', 'value' => 'stored')),
+                        array('assign-type' => 'variable', 'operator' => 'assign', 'variable' => 'reset', 'expr' => array('type' => 'string', 'value' => '')),
+                        array('assign-type' => 'variable', 'operator' => 'concat-assign', 'variable' => 'reset', 'expr' => array('type' => 'string', 'value' => 'x')),
+                    )
+                )
+            )
+        );
+
+        $built = new Variable('string', 'built', null);
+        $stored = new Variable('string', 'stored', null);
+        $reset = new Variable('string', 'reset', null);
+
+        $context->backend->onLoopEnter($loop, $context);
+        $context->insideCycle++;
+        $this->assertEquals('zephir_concat_self_grow', $context->backend->getConcatSelfFunction('', $context, $built));
+        $this->assertEquals('zephir_concat_self', $context->backend->getConcatSelfFunction('', $context, $stored));
+        $this->assertEquals('zephir_concat_self_grow_str', $context->backend->getConcatSelfFunction('_str', $context, $reset));
+        $context->insideCycle--;
+        $context->backend->onLoopExit($context);
+
+        $this->assertEquals("zephir_concat_self_trim(&built);\nzephir_concat_self_trim(&reset);", trim($context->codePrinter->getOutput()));
+        $this->assertEquals('zephir_concat_self', $context->backend->getConcatSelfFunction('', $context, $built));
+    }
+}
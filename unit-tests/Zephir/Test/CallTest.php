@@ -0,0 +1,76 @@
+<?php
+
+/*
+ +--------------------------------------------------------------------------+
+ | Zephir Language                                                          |
+ +--------------------------------------------------------------------------+
+ | Copyright (c) 2013-2015 Zephir Team and contributors                     |
+ +--------------------------------------------------------------------------+
+ | This source file is subject the MIT license, that is bundled with        |
+ | this package in the file LICENSE, and is available through the           |
+ | world-wide-web at the following url:                                     |
+ | http://zephir-lang.com/license.html                                      |
+ |                                                                          |
+ | If you did not receive a copy of the MIT license and are unable          |
+ | to obtain it through the world-wide-web, please send a note to           |
+ | license@zephir-lang.com so we can mail you a copy immediately.           |
+ +--------------------------------------------------------------------------+
+*/
+
+namespace Zephir\Test;
+
+use Zephir\Call;
+use Zephir\ClassDefinition;
+use Zephir\ClassMethod;
+use Zephir\ClassMethodParameters;
+use Zephir\CompilationContext;
+use Zephir\CompiledExpression;
+
+class CallTest extends \PHPUnit_Framework_TestCase
+{
+    protected function getInternalMethod()
+    {
+        $parameters = new ClassMethodParameters(array(
+            array('type' => 'parameter', 'name' => 'a', 'data-type' => 'long', 'mandatory' => 0),
+            array('type' => 'parameter', 'name' => 'b', 'data-type' => 'variable', 'mandatory' => 0, 'default' => array('type' => 'null'))
+        ));
+        return new ClassMethod(new ClassDefinition('Test', 'Foo'), array('internal'), 'foo', $parameters);
+    }
+
+    protected function getParameters($number)
+    {
+        $parameters = array();
+        for ($i = 0; $i < $number; $i++) {
+            $parameters[] = array('parameter' => new CompiledExpression('int', (string) $i, array()));
+        }
+        return $parameters;
+    }
+
+    public function testCanCallInternal()
+    {
+        $call = new Call();
+        $method = $this->getInternalMethod();
+        $context = new CompilationContext();
+
+        $this->assertFalse($call->canCallInternal($method, $this->getParameters(0), $context, array()));
+        $this->assertTrue($call->canCallInternal($method, $this->getParameters(1), $context, array()));
+        $this->assertTrue($call->canCallInternal($method, $this->getParameters(2), $context, array()));
+        $this->assertFalse($call->canCallInternal($method, $this->getParameters(3), $context, array()));
+    }
+
+    public function testMissingParametersToInternalMethod()
+    {
+        $this->setExpectedException('Zephir\CompilerException', "Invalid parameters passed to internal method: 'foo'");
+
+        $call = new Call();
+        $call->getResolvedParams($this->getParameters(0), new CompilationContext(), array(), $this->getInternalMethod());
+    }
+
+    public function testExtraParametersToInternalMethod()
+    {
+        $this->setExpectedException('Zephir\CompilerException', "Invalid parameters passed to internal method: 'foo'");
+
+        $call = new Call();
+        $call->getResolvedParams($this->getParameters(3), new CompilationContext(), array(), $this->getInternalMethod());
+    }
+}
@@ -0,0 +1,70 @@
+<?php
+
+/*
+ +--------------------------------------------------------------------------+
+ | Zephir Language                                                          |
+ +--------------------------------------------------------------------------+
+ | Copyright (c) 2013-2015 Zephir Team and contributors                     |
+ +--------------------------------------------------------------------------+
+ | This source file is subject the MIT license, that is bundled with        |
+ | this package in the file LICENSE, and is available through the           |
+ | world-wide-web at the following url:                                     |
+ | http://zephir-lang.com/license.html                                      |
+ |                                                                          |
+ | If you did not receive a copy of the MIT license and are unable          |
+ | to obtain it through the world-wide-web, please send a note to           |
+ | license@zephir-lang.com so we can mail you a copy immediately.           |
+ +--------------------------------------------------------------------------+
+*/
+
+namespace Zephir\Test;
+
+use Zephir\CompilationContext;
+use Zephir\FunctionCall;
+use Zephir\Backends\ZendEngine2\Backend as ZendEngine2Backend;
+use Zephir\Backends\ZendEngine3\Backend as ZendEngine3Backend;
+
+class FunctionCallTest extends \PHPUnit_Framework_TestCase
+{
+    protected function isInternalFastCall($funcName, $backend)
+    {
+        $context = new CompilationContext();
+        $context->backend = $backend;
+
+        $method = new \ReflectionMethod('Zephir\FunctionCall', 'isInternalFastCall');
+        $method->setAccessible(true);
+        return $method->invoke(new FunctionCall(), $funcName, $context);
+    }
+
+    public function testInternalFastCall()
+    {
+        $backend = new ZendEngine3Backend();
+        $this->assertTrue($this->isInternalFastCall('str_repeat', $backend));
+        $this->assertTrue($this->isInternalFastCall('Str_Repeat', $backend));
+        $this->assertFalse($this->isInternalFastCall('str_repeat', new ZendEngine2Backend()));
+    }
+
+    public function testInternalFastCallExclusions()
+    {
+        $backend = new ZendEngine3Backend();
+
+        /* Functions inspecting the calling frame */
+        $this->assertFalse($this->isInternalFastCall('func_get_args', $backend));
+        $this->assertFalse($this->isInternalFastCall('Call_User_Func', $backend));
+
+        /* Parameters passed by reference */
+        $this->assertFalse($this->isInternalFastCall('sort', $backend));
+
+        /* Functions that aren't implemented in C */
+        $this->assertFalse($this->isInternalFastCall('zephir_function_that_does_not_exist', $backend));
+    }
+
+    public function testDeprecatedFunctionIsNotFastCalled()
+    {
+        if (PHP_VERSION_ID < 70200 || !function_exists('create_function')) {
+            $this->markTestSkipped('create_function() is only deprecated since PHP 7.2');
+        }
+
+        $this->assertFalse($this->isInternalFastCall('create_function', new ZendEngine3Backend()));
+    }
+}
@@ -0,0 +1,15 @@
+#!/bin/bash
+
+# Rebuilds the test extension with call site profiling, runs the extension tests
+# and checks that every call consumed the mark left by its call macro
+
+set -e
+
+export ZEPHIR_FCALL_PROFILE_OUTPUT="$TRAVIS_BUILD_DIR/fcall-profile.json"
+export ZEPHIR_FCALL_PROFILE_FORMAT=json
+
+(cd ext; make clean > /dev/null; make -j2 CFLAGS="-g3 -O1 -fno-delete-null-pointer-checks -Wall -fvisibility=hidden -DZEPHIR_RELEASE=1 -DZEPHIR_FCALL_PROFILE" > /dev/null; make install > /dev/null)
+
+phpunit --testsuite "Extension Test Suite" > /dev/null || true
+
+$(phpenv which php) -n ./unit-tests/ci/fcall_profile_check.php "$ZEPHIR_FCALL_PROFILE_OUTPUT"
@@ -0,0 +1,29 @@
+<?php
+
+/**
+ * Checks the call site report of a profiling build: the report must exist, have sites
+ * and no stale marks, this is, marks left by a call macro that its call never consumed
+ */
+
+if ($argc < 2 || !is_file($argv[1])) {
+    fwrite(STDERR, "The call site report wasn't written\n");
+    exit(1);
+}
+
+$report = json_decode(file_get_contents($argv[1]), true);
+if (!is_array($report) || !isset($report['sites'], $report['stale'])) {
+    fwrite(STDERR, "The call site report isn't valid JSON\n");
+    exit(1);
+}
+
+if (!count($report['sites'])) {
+    fwrite(STDERR, "The call site report doesn't have call sites\n");
+    exit(1);
+}
+
+if ($report['stale'] > 0) {
+    fwrite(STDERR, $report['stale'] . " call site marks were never consumed\n");
+    exit(1);
+}
+
+echo count($report['sites']) . " call sites profiled, all marks consumed\n";